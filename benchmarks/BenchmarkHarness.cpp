@@ -0,0 +1,270 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#include <BenchmarkHarness.hpp>
+#include <NekiraECS/Core/Primary/PrimaryType.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+
+// ===============================
+// 全局分配统计
+// ===============================
+
+namespace
+{
+std::atomic<uint64_t> AllocatedBytes{0};
+std::atomic<uint64_t> AllocationCount{0};
+
+volatile uint64_t Sink = 0;
+
+void* Allocate(size_t size)
+{
+    AllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    AllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+void* AllocateAligned(size_t size, std::align_val_t alignment)
+{
+    AllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    AllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    const auto ALIGNMENT = static_cast<size_t>(alignment);
+
+#if defined(_MSC_VER)
+    void* ptr = _aligned_malloc(size == 0 ? 1 : size, ALIGNMENT);
+#else
+    // aligned_alloc要求大小是对齐的整数倍
+    void* ptr = std::aligned_alloc(ALIGNMENT, (std::max<size_t>(size, 1) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT);
+#endif
+
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+void FreeAligned(void* ptr)
+{
+#if defined(_MSC_VER)
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+} // namespace
+
+
+void* operator new(size_t size)
+{
+    return Allocate(size);
+}
+
+void* operator new[](size_t size)
+{
+    return Allocate(size);
+}
+
+void* operator new(size_t size, std::align_val_t alignment)
+{
+    return AllocateAligned(size, alignment);
+}
+
+void* operator new[](size_t size, std::align_val_t alignment)
+{
+    return AllocateAligned(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t /*size*/) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t /*size*/) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t /*alignment*/) noexcept
+{
+    FreeAligned(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t /*alignment*/) noexcept
+{
+    FreeAligned(ptr);
+}
+
+void operator delete(void* ptr, size_t /*size*/, std::align_val_t /*alignment*/) noexcept
+{
+    FreeAligned(ptr);
+}
+
+void operator delete[](void* ptr, size_t /*size*/, std::align_val_t /*alignment*/) noexcept
+{
+    FreeAligned(ptr);
+}
+
+
+namespace NekiraECS::Benchmarks
+{
+
+AllocationStats GetAllocationStats()
+{
+    return AllocationStats{.Bytes = AllocatedBytes.load(std::memory_order_relaxed),
+                           .Count = AllocationCount.load(std::memory_order_relaxed)};
+}
+
+
+void KeepAlive(uint64_t value)
+{
+    Sink = Sink + value;
+}
+
+
+// ===============================
+// BenchmarkState
+// ===============================
+
+BenchmarkState::BenchmarkState(size_t count) : Count(count)
+{}
+
+
+size_t BenchmarkState::GetCount() const
+{
+    return Count;
+}
+
+
+size_t BenchmarkState::GetOperations() const
+{
+    return Operations;
+}
+
+
+double BenchmarkState::GetNanoseconds() const
+{
+    return Nanoseconds;
+}
+
+
+const AllocationStats& BenchmarkState::GetAllocated() const
+{
+    return Allocated;
+}
+
+
+// ===============================
+// BenchmarkRunner
+// ===============================
+
+BenchmarkRunner::BenchmarkRunner(size_t repetitions, std::string filter) :
+    Repetitions(std::max<size_t>(repetitions, 1)), Filter(std::move(filter))
+{}
+
+
+void BenchmarkRunner::Run(std::string_view name, std::string_view unit, std::span<const size_t> counts,
+                          BenchmarkFunc func)
+{
+    if (!Filter.empty() && name.find(Filter) == std::string_view::npos)
+    {
+        return;
+    }
+
+    for (const size_t COUNT : counts)
+    {
+        std::vector<double> samples;
+        samples.reserve(Repetitions);
+
+        BenchmarkResult result{.Name = std::string(name), .Unit = std::string(unit), .Count = COUNT};
+
+        result.BytesAllocated = UINT64_MAX;
+        result.Allocations = UINT64_MAX;
+
+        for (size_t repetition = 0; repetition < Repetitions; ++repetition)
+        {
+            BenchmarkState state(COUNT);
+            func(state);
+
+            const size_t OPERATIONS = std::max<size_t>(state.GetOperations(), 1);
+
+            samples.push_back(state.GetNanoseconds() / static_cast<double>(OPERATIONS));
+
+            result.Operations = state.GetOperations();
+            result.BytesAllocated = std::min(result.BytesAllocated, state.GetAllocated().Bytes);
+            result.Allocations = std::min(result.Allocations, state.GetAllocated().Count);
+        }
+
+        std::ranges::sort(samples);
+        result.NanosecondsPerOperation = samples[samples.size() / 2];
+
+        std::cerr << result.Name << " [" << result.Count << " " << result.Unit
+                  << "]: " << result.NanosecondsPerOperation << " ns/op, " << result.BytesAllocated << " bytes\n";
+
+        Results.push_back(std::move(result));
+    }
+}
+
+
+void BenchmarkRunner::WriteJson(std::ostream& stream) const
+{
+    stream << "{\n";
+    stream << "  \"context\": {\n";
+    stream << "    \"entity_id_bits\": " << sizeof(EntityIDType) * 8 << ",\n";
+    stream << "    \"entity_index_bits\": " << static_cast<int>(EntityIDLayout::INDEX_BITS) << ",\n";
+    stream << "    \"repetitions\": " << Repetitions << "\n";
+    stream << "  },\n";
+    stream << "  \"benchmarks\": [";
+
+    for (size_t index = 0; index < Results.size(); ++index)
+    {
+        const auto& result = Results[index];
+
+        // 名字只包含标识符字符，不需要转义
+        stream << (index == 0 ? "\n" : ",\n");
+        stream << "    {\"name\": \"" << result.Name << "\", \"unit\": \"" << result.Unit
+               << "\", \"count\": " << result.Count << ", \"operations\": " << result.Operations
+               << ", \"ns_per_op\": " << result.NanosecondsPerOperation
+               << ", \"bytes_allocated\": " << result.BytesAllocated << ", \"allocations\": " << result.Allocations
+               << "}";
+    }
+
+    stream << "\n  ]\n}\n";
+}
+
+
+const std::vector<BenchmarkResult>& BenchmarkRunner::GetResults() const
+{
+    return Results;
+}
+
+} // namespace NekiraECS::Benchmarks
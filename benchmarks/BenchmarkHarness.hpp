@@ -0,0 +1,132 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace NekiraECS::Benchmarks
+{
+
+// 全局operator new的累计统计
+struct AllocationStats final
+{
+    uint64_t Bytes = 0;
+    uint64_t Count = 0;
+};
+
+// 获取进程启动以来的分配统计(由本目标替换的全局operator new记录)
+AllocationStats GetAllocationStats();
+
+// 防止结果被编译器优化掉
+void KeepAlive(uint64_t value);
+
+
+// 单次运行的上下文：提供规模参数，并测量计时区间
+class BenchmarkState final
+{
+public:
+    explicit BenchmarkState(size_t count);
+
+    // 规模参数(实体数量或系统数量)
+    [[nodiscard]] size_t GetCount() const;
+
+    // 测量func，operations为func中执行的操作数。每次运行只应调用一次
+    template <typename Func>
+    void Measure(size_t operations, Func&& func)
+    {
+        const AllocationStats BEFORE = GetAllocationStats();
+        const auto            START = std::chrono::steady_clock::now();
+
+        func();
+
+        const auto            END = std::chrono::steady_clock::now();
+        const AllocationStats AFTER = GetAllocationStats();
+
+        Operations = operations;
+        Nanoseconds = std::chrono::duration<double, std::nano>(END - START).count();
+        Allocated.Bytes = AFTER.Bytes - BEFORE.Bytes;
+        Allocated.Count = AFTER.Count - BEFORE.Count;
+    }
+
+    [[nodiscard]] size_t GetOperations() const;
+
+    [[nodiscard]] double GetNanoseconds() const;
+
+    [[nodiscard]] const AllocationStats& GetAllocated() const;
+
+private:
+    size_t Count = 0;
+
+    size_t Operations = 0;
+
+    double Nanoseconds = 0.0;
+
+    AllocationStats Allocated;
+};
+
+
+// 基准测试函数：准备数据后调用一次state.Measure
+using BenchmarkFunc = void (*)(BenchmarkState& state);
+
+// 一个基准测试在某个规模下的结果
+struct BenchmarkResult final
+{
+    std::string Name;
+    std::string Unit;
+
+    size_t Count = 0;
+    size_t Operations = 0;
+
+    // 多次重复的中位数
+    double NanosecondsPerOperation = 0.0;
+
+    // 多次重复中的最小值，排除首次运行的一次性分配
+    uint64_t BytesAllocated = 0;
+    uint64_t Allocations = 0;
+};
+
+/**
+ * 基准测试运行器
+ *
+ * @[INFO] 运行逻辑：
+ *
+ * 1.每个规模重复运行Repetitions次，每次都重新准备数据，只计时Measure中的部分。
+ * 2.耗时取每次操作耗时的中位数，分配取最小值。
+ * 3.名字包含Filter(为空时全部运行)的基准测试才会运行。
+ */
+class BenchmarkRunner final
+{
+public:
+    BenchmarkRunner(size_t repetitions, std::string filter);
+
+    // 按counts中的每个规模运行func，unit为规模的单位(例如"entities")
+    void Run(std::string_view name, std::string_view unit, std::span<const size_t> counts, BenchmarkFunc func);
+
+    // 以JSON输出所有结果
+    void WriteJson(std::ostream& stream) const;
+
+    [[nodiscard]] const std::vector<BenchmarkResult>& GetResults() const;
+
+private:
+    size_t Repetitions = 1;
+
+    std::string Filter;
+
+    std::vector<BenchmarkResult> Results;
+};
+
+} // namespace NekiraECS::Benchmarks
@@ -0,0 +1,408 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#include <BenchmarkHarness.hpp>
+#include <NekiraECS/Core/World/World.hpp>
+#include <array>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace NekiraECS::Benchmarks
+{
+
+namespace
+{
+struct Position
+{
+    float X = 0.0F;
+    float Y = 0.0F;
+    float Z = 0.0F;
+};
+
+struct Velocity
+{
+    float X = 0.0F;
+    float Y = 0.0F;
+    float Z = 0.0F;
+};
+
+// 用于制造大量已注册的组件类型
+template <size_t I>
+struct Payload
+{
+    uint32_t Value = 0;
+};
+
+// 用于制造大量系统
+template <size_t I>
+class CounterSystem final : public System<CounterSystem<I>>
+{
+public:
+    void OnUpdate(float /*deltaTime*/) override
+    {
+        ++Updates;
+    }
+
+    uint64_t Updates = 0;
+};
+
+// 注册的组件类型与系统数量上限
+constexpr size_t PAYLOAD_TYPE_COUNT = 64;
+constexpr size_t MAX_SYSTEM_COUNT = 256;
+
+// 系统更新的次数
+constexpr size_t SYSTEM_UPDATE_COUNT = 1000;
+
+template <size_t... Is>
+void AddPayloads(World& world, const Entity& entity, std::index_sequence<Is...> /*indices*/)
+{
+    (world.AddComponent<Payload<Is>>(entity), ...);
+}
+
+template <size_t... Is>
+constexpr auto MakeSystemRegisters(std::index_sequence<Is...> /*indices*/)
+{
+    return std::array<void (*)(World&), sizeof...(Is)>{
+        [](World& world) { world.RegisterSystem<CounterSystem<Is>>(); }...};
+}
+
+// 第I个函数注册CounterSystem<I>
+constexpr auto SYSTEM_REGISTERS = MakeSystemRegisters(std::make_index_sequence<MAX_SYSTEM_COUNT>{});
+
+// 创建count个实体
+std::vector<Entity> CreateEntities(World& world, size_t count)
+{
+    std::vector<Entity> entities;
+    world.CreateEntities(count, entities);
+    return entities;
+}
+
+// 创建count个同时拥有Position与Velocity的实体
+std::vector<Entity> CreateMovers(World& world, size_t count)
+{
+    auto entities = CreateEntities(world, count);
+
+    for (const auto& entity : entities)
+    {
+        world.AddComponent<Position>(entity);
+        world.AddComponent<Velocity>(entity, 1.0F, 1.0F, 1.0F);
+    }
+
+    return entities;
+}
+
+
+// ===============================
+// Benchmarks
+// ===============================
+
+void CreateEntity(BenchmarkState& state)
+{
+    World        world;
+    const size_t COUNT = state.GetCount();
+
+    state.Measure(COUNT,
+                  [&world, COUNT]
+                  {
+                      for (size_t index = 0; index < COUNT; ++index)
+                      {
+                          world.CreateEntity();
+                      }
+                  });
+}
+
+void DestroyEntity(BenchmarkState& state)
+{
+    World      world;
+    const auto ENTITIES = CreateEntities(world, state.GetCount());
+
+    state.Measure(ENTITIES.size(),
+                  [&world, &ENTITIES]
+                  {
+                      for (const auto& entity : ENTITIES)
+                      {
+                          world.DestroyEntity(entity);
+                      }
+                  });
+}
+
+void AddComponent(BenchmarkState& state)
+{
+    World      world;
+    const auto ENTITIES = CreateEntities(world, state.GetCount());
+
+    state.Measure(ENTITIES.size(),
+                  [&world, &ENTITIES]
+                  {
+                      for (const auto& entity : ENTITIES)
+                      {
+                          world.AddComponent<Position>(entity, 1.0F, 2.0F, 3.0F);
+                      }
+                  });
+}
+
+void GetComponent(BenchmarkState& state)
+{
+    World      world;
+    const auto ENTITIES = CreateMovers(world, state.GetCount());
+
+    state.Measure(ENTITIES.size(),
+                  [&world, &ENTITIES]
+                  {
+                      float sum = 0.0F;
+
+                      for (const auto& entity : ENTITIES)
+                      {
+                          sum += world.GetComponent<Position>(entity)->X;
+                      }
+
+                      KeepAlive(static_cast<uint64_t>(sum));
+                  });
+}
+
+void HasComponent(BenchmarkState& state)
+{
+    World      world;
+    const auto ENTITIES = CreateEntities(world, state.GetCount());
+
+    // 一半的实体拥有该组件
+    for (size_t index = 0; index < ENTITIES.size(); index += 2)
+    {
+        world.AddComponent<Position>(ENTITIES[index]);
+    }
+
+    state.Measure(ENTITIES.size(),
+                  [&world, &ENTITIES]
+                  {
+                      uint64_t found = 0;
+
+                      for (const auto& entity : ENTITIES)
+                      {
+                          found += world.HasComponent<Position>(entity) ? 1 : 0;
+                      }
+
+                      KeepAlive(found);
+                  });
+}
+
+void RemoveComponent(BenchmarkState& state)
+{
+    World      world;
+    const auto ENTITIES = CreateMovers(world, state.GetCount());
+
+    state.Measure(ENTITIES.size(),
+                  [&world, &ENTITIES]
+                  {
+                      for (const auto& entity : ENTITIES)
+                      {
+                          world.RemoveComponent<Position>(entity);
+                      }
+                  });
+}
+
+void ForEachComponent(BenchmarkState& state)
+{
+    World      world;
+    const auto ENTITIES = CreateMovers(world, state.GetCount());
+
+    state.Measure(ENTITIES.size(),
+                  [&world]
+                  {
+                      world.ForEachComponent<Position>([](Position& position) { position.X += 1.0F; });
+                  });
+}
+
+void EachMultiComponent(BenchmarkState& state)
+{
+    World      world;
+    const auto ENTITIES = CreateMovers(world, state.GetCount());
+
+    state.Measure(ENTITIES.size(),
+                  [&world]
+                  {
+                      world.Each<Position, Velocity>(
+                          [](const Entity& /*entity*/, Position& position, const Velocity& velocity)
+                          {
+                              position.X += velocity.X;
+                              position.Y += velocity.Y;
+                              position.Z += velocity.Z;
+                          });
+                  });
+}
+
+void GroupEachMultiComponent(BenchmarkState& state)
+{
+    World      world;
+    const auto ENTITIES = CreateMovers(world, state.GetCount());
+
+    auto group = world.Group<Position, Velocity>();
+
+    state.Measure(ENTITIES.size(),
+                  [&group]
+                  {
+                      group.Each(
+                          [](const Entity& /*entity*/, Position& position, const Velocity& velocity)
+                          {
+                              position.X += velocity.X;
+                              position.Y += velocity.Y;
+                              position.Z += velocity.Z;
+                          });
+                  });
+}
+
+void RemoveEntityAllComponents(BenchmarkState& state)
+{
+    World      world;
+    const auto ENTITIES = CreateMovers(world, state.GetCount());
+
+    // 注册PAYLOAD_TYPE_COUNT种组件类型，只有第一个实体拥有它们
+    if (!ENTITIES.empty())
+    {
+        AddPayloads(world, ENTITIES.front(), std::make_index_sequence<PAYLOAD_TYPE_COUNT>{});
+    }
+
+    state.Measure(ENTITIES.size(),
+                  [&world, &ENTITIES]
+                  {
+                      for (const auto& entity : ENTITIES)
+                      {
+                          world.RemoveEntityAllComponents(entity);
+                      }
+                  });
+}
+
+void UpdateSystems(BenchmarkState& state)
+{
+    World world;
+
+    for (size_t index = 0; index < state.GetCount(); ++index)
+    {
+        SYSTEM_REGISTERS[index](world);
+    }
+
+    state.Measure(SYSTEM_UPDATE_COUNT,
+                  [&world]
+                  {
+                      for (size_t update = 0; update < SYSTEM_UPDATE_COUNT; ++update)
+                      {
+                          world.UpdateSystems(1.0F / 60.0F);
+                      }
+                  });
+}
+
+
+// 实体规模：1k起每次乘10，最后加上可创建的最大实体数量(不超过maxEntities)
+std::vector<size_t> MakeEntityCounts(size_t maxEntities)
+{
+    const size_t LIMIT = std::min(static_cast<size_t>(ENTITY_INDEX_MAX) + 1, maxEntities);
+
+    std::vector<size_t> counts;
+
+    for (size_t count = 1000; count < LIMIT; count *= 10)
+    {
+        counts.push_back(count);
+    }
+
+    counts.push_back(LIMIT);
+
+    return counts;
+}
+
+void PrintUsage()
+{
+    std::cerr << "Usage: NekiraECSBenchmarks [--output <file>] [--filter <name>] [--repetitions <n>] "
+                 "[--max-entities <n>]\n";
+}
+} // namespace
+
+} // namespace NekiraECS::Benchmarks
+
+
+int main(int argc, char** argv)
+{
+    using namespace NekiraECS::Benchmarks;
+
+    std::string output;
+    std::string filter;
+    size_t      repetitions = 5;
+    size_t      maxEntities = size_t{1} << 20;
+
+    for (int index = 1; index < argc; ++index)
+    {
+        const std::string ARG = argv[index];
+
+        if (index + 1 >= argc)
+        {
+            PrintUsage();
+            return 1;
+        }
+
+        const std::string VALUE = argv[++index];
+
+        if (ARG == "--output")
+        {
+            output = VALUE;
+        }
+        else if (ARG == "--filter")
+        {
+            filter = VALUE;
+        }
+        else if (ARG == "--repetitions")
+        {
+            repetitions = std::stoul(VALUE);
+        }
+        else if (ARG == "--max-entities")
+        {
+            maxEntities = std::stoul(VALUE);
+        }
+        else
+        {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    const auto                  ENTITY_COUNTS = MakeEntityCounts(maxEntities);
+    const std::array<size_t, 3> SYSTEM_COUNTS = {16, 64, MAX_SYSTEM_COUNT};
+
+    BenchmarkRunner runner(repetitions, filter);
+
+    runner.Run("CreateEntity", "entities", ENTITY_COUNTS, &CreateEntity);
+    runner.Run("DestroyEntity", "entities", ENTITY_COUNTS, &DestroyEntity);
+    runner.Run("AddComponent", "entities", ENTITY_COUNTS, &AddComponent);
+    runner.Run("GetComponent", "entities", ENTITY_COUNTS, &GetComponent);
+    runner.Run("HasComponent", "entities", ENTITY_COUNTS, &HasComponent);
+    runner.Run("RemoveComponent", "entities", ENTITY_COUNTS, &RemoveComponent);
+    runner.Run("ForEachComponent", "entities", ENTITY_COUNTS, &ForEachComponent);
+    runner.Run("EachMultiComponent", "entities", ENTITY_COUNTS, &EachMultiComponent);
+    runner.Run("GroupEachMultiComponent", "entities", ENTITY_COUNTS, &GroupEachMultiComponent);
+    runner.Run("RemoveEntityAllComponents", "entities", ENTITY_COUNTS, &RemoveEntityAllComponents);
+    runner.Run("UpdateSystems", "systems", SYSTEM_COUNTS, &UpdateSystems);
+
+    if (output.empty())
+    {
+        runner.WriteJson(std::cout);
+        return 0;
+    }
+
+    std::ofstream file(output);
+
+    if (!file)
+    {
+        std::cerr << "Failed to open " << output << "\n";
+        return 1;
+    }
+
+    runner.WriteJson(file);
+
+    return 0;
+}
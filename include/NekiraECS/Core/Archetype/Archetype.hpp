@@ -0,0 +1,168 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <NekiraECS/Core/Component/Component.hpp>
+#include <cstddef>
+#include <new>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+namespace NekiraECS
+{
+
+// 类型擦除后的组件信息，原型存储通过它来搬运、析构组件
+struct ComponentTypeInfo final
+{
+    ComponentTypeID ID;
+
+    size_t Size;
+
+    size_t Align;
+
+    // 在dst上移动构造src
+    void (*MoveConstruct)(void* dst, void* src);
+
+    // 析构ptr处的组件
+    void (*Destroy)(void* ptr);
+
+    template <typename T>
+    static const ComponentTypeInfo* Get()
+    {
+        static const ComponentTypeInfo INFO{
+            .ID = GetComponentTypeID<T>(),
+            .Size = sizeof(T),
+            .Align = alignof(T),
+            .MoveConstruct = [](void* dst, void* src) { ::new (dst) T(std::move(*static_cast<T*>(src))); },
+            .Destroy = [](void* ptr) { static_cast<T*>(ptr)->~T(); }};
+
+        return &INFO;
+    }
+};
+
+} // namespace NekiraECS
+
+
+
+namespace NekiraECS
+{
+
+/**
+ * 原型：拥有相同组件集合的实体存放在同一个原型中
+ *
+ * @[INFO] 内存布局：
+ *
+ * 1.实体按行存放在固定大小(CHUNK_SIZE)的Chunk中，第row行位于第(row / ChunkCapacity)个Chunk的第(row % ChunkCapacity)个槽位。
+ * 2.每个Chunk内部是SoA布局：[EntityIndices | Column0 | Column1 | ...]，每一列都按组件的对齐要求对齐。
+ * 3.所有行保持紧凑，移除某一行时把最后一行搬运过来填补空位。
+ */
+class Archetype final
+{
+public:
+    // 每个Chunk的默认字节数
+    static constexpr size_t CHUNK_SIZE = 16 * 1024;
+
+    // Chunk的对齐(缓存行)
+    static constexpr size_t CHUNK_ALIGNMENT = 64;
+
+    // 未找到列时的返回值
+    static constexpr size_t INVALID_COLUMN = static_cast<size_t>(-1);
+
+    // types需按ID有序且不重复
+    explicit Archetype(std::vector<const ComponentTypeInfo*> types);
+
+    ~Archetype();
+
+    Archetype(const Archetype&) = delete;
+    Archetype(Archetype&&) noexcept = delete;
+
+    Archetype& operator=(const Archetype&) = delete;
+    Archetype& operator=(Archetype&&) noexcept = delete;
+
+    // 该原型的组件集合
+    [[nodiscard]] const std::vector<const ComponentTypeInfo*>& GetTypes() const;
+
+    // 查找组件类型对应的列
+    [[nodiscard]] size_t FindColumn(ComponentTypeID typeID) const
+    {
+        return typeID < ColumnLookup.size() ? ColumnLookup[typeID] : INVALID_COLUMN;
+    }
+
+    // 原型中的实体数量
+    [[nodiscard]] size_t Size() const;
+
+    // 每个Chunk可容纳的实体数量
+    [[nodiscard]] size_t GetChunkCapacity() const;
+
+    // Chunk的数量
+    [[nodiscard]] size_t GetChunkCount() const;
+
+    // 每个Chunk的字节数
+    [[nodiscard]] size_t GetChunkBytes() const;
+
+    // 第chunkIndex个Chunk中的实体数量
+    [[nodiscard]] size_t GetChunkSize(size_t chunkIndex) const;
+
+    // 分配新的一行，返回行号。该行的组件尚未构造，由调用者负责构造
+    size_t AllocateRow(EntityIndexType entityIndex);
+
+    // 析构某一行的所有组件，并把最后一行搬运到该行。若发生了搬运，返回true并输出被搬运的实体索引
+    bool RemoveRow(size_t row, EntityIndexType& outMovedEntity);
+
+    // 某一行对应的实体索引
+    [[nodiscard]] EntityIndexType GetEntityIndex(size_t row) const;
+
+    // 获取某一行某一列的组件地址
+    [[nodiscard]] void* GetComponentData(size_t column, size_t row) const;
+
+    // 获取某个Chunk中的实体索引数组
+    [[nodiscard]] EntityIndexType* GetChunkEntities(size_t chunkIndex) const;
+
+    // 获取某个Chunk中某一列的起始地址
+    template <typename T>
+    [[nodiscard]] T* GetChunkColumn(size_t column, size_t chunkIndex) const
+    {
+        return std::launder(reinterpret_cast<T*>(Chunks[chunkIndex] + ColumnOffsets[column]));
+    }
+
+    // 缓存的原型转移：添加typeID后到达的原型
+    [[nodiscard]] Archetype* GetAddEdge(ComponentTypeID typeID) const;
+    void                     SetAddEdge(ComponentTypeID typeID, Archetype* target);
+
+    // 缓存的原型转移：移除typeID后到达的原型
+    [[nodiscard]] Archetype* GetRemoveEdge(ComponentTypeID typeID) const;
+    void                     SetRemoveEdge(ComponentTypeID typeID, Archetype* target);
+
+private:
+    // 组件集合(按ID有序)
+    std::vector<const ComponentTypeInfo*> Types;
+
+    // ComponentTypeID -> 列，不存在的类型为INVALID_COLUMN
+    std::vector<size_t> ColumnLookup;
+
+    // 每一列在Chunk中的字节偏移
+    std::vector<size_t> ColumnOffsets;
+
+    // 每个Chunk的字节数与容量
+    size_t ChunkBytes = CHUNK_SIZE;
+    size_t ChunkCapacity = 1;
+
+    // 实体数量
+    size_t Count = 0;
+
+    std::vector<std::byte*> Chunks;
+
+    // 原型转移图
+    std::unordered_map<ComponentTypeID, Archetype*> AddEdges;
+    std::unordered_map<ComponentTypeID, Archetype*> RemoveEdges;
+};
+
+} // namespace NekiraECS
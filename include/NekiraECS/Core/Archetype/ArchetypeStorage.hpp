@@ -0,0 +1,352 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <NekiraECS/Core/Archetype/Archetype.hpp>
+#include <NekiraECS/Tasks/ThreadPool.hpp>
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+
+namespace NekiraECS
+{
+
+// 原型存储：ComponentManager的可选存储后端，拥有相同组件集合的实体存放在同一个原型的Chunk中
+class ArchetypeStorage final
+{
+public:
+    ArchetypeStorage() = default;
+    ~ArchetypeStorage() = default;
+
+    ArchetypeStorage(const ArchetypeStorage&) = delete;
+    ArchetypeStorage(ArchetypeStorage&&) noexcept = delete;
+
+    ArchetypeStorage& operator=(const ArchetypeStorage&) = delete;
+    ArchetypeStorage& operator=(ArchetypeStorage&&) noexcept = delete;
+
+    // 添加组件，如果已存在则替换
+    template <typename T, typename... Args>
+    void AddComponent(EntityIndexType entityIndex, Args&&... args)
+    {
+        static_assert(alignof(T) <= Archetype::CHUNK_ALIGNMENT, "Component alignment exceeds the chunk alignment");
+
+        if (T* existing = GetComponent<T>(entityIndex))
+        {
+            *existing = T(std::forward<Args>(args)...);
+            return;
+        }
+
+        // 先构造组件，构造抛出异常时实体仍留在原来的原型中。与MoveEntity相同，之后的移动构造假定不会抛出异常
+        T component(std::forward<Args>(args)...);
+
+        const auto* info = ComponentTypeInfo::Get<T>();
+
+        auto* target = GetAddTarget(GetArchetype(entityIndex), info);
+
+        // 把实体搬运到目标原型，再把组件移动到新的列上
+        const size_t ROW = MoveEntity(entityIndex, target);
+
+        ::new (target->GetComponentData(target->FindColumn(info->ID), ROW)) T(std::move(component));
+    }
+
+    // 获取组件，如果不存在则返回nullptr
+    template <typename T>
+    T* GetComponent(EntityIndexType entityIndex) const
+    {
+        auto* owner = GetArchetype(entityIndex);
+
+        if (owner == nullptr)
+        {
+            return nullptr;
+        }
+
+        const size_t COLUMN = owner->FindColumn(GetComponentTypeID<T>());
+
+        if (COLUMN == Archetype::INVALID_COLUMN)
+        {
+            return nullptr;
+        }
+
+        return std::launder(static_cast<T*>(owner->GetComponentData(COLUMN, EntityLocations[entityIndex].Row)));
+    }
+
+    // 是否拥有该组件
+    template <typename T>
+    [[nodiscard]] bool HasComponent(EntityIndexType entityIndex) const
+    {
+        auto* owner = GetArchetype(entityIndex);
+
+        return owner != nullptr && owner->FindColumn(GetComponentTypeID<T>()) != Archetype::INVALID_COLUMN;
+    }
+
+    // 移除实体的某个组件
+    template <typename T>
+    void RemoveComponent(EntityIndexType entityIndex)
+    {
+        if (!HasComponent<T>(entityIndex))
+        {
+            return;
+        }
+
+        auto* target = GetRemoveTarget(GetArchetype(entityIndex), GetComponentTypeID<T>());
+
+        if (target == nullptr)
+        {
+            RemoveEntityAllComponents(entityIndex);
+            return;
+        }
+
+        MoveEntity(entityIndex, target);
+    }
+
+    // 移除所有实体的某个组件
+    template <typename T>
+    void RemoveComponentFromAll()
+    {
+        std::vector<EntityIndexType> owners;
+
+        ForEachArchetypeWith(GetComponentTypeID<T>(),
+                             [&owners](Archetype& archetype)
+                             {
+                                 for (size_t row = 0; row < archetype.Size(); ++row)
+                                 {
+                                     owners.push_back(archetype.GetEntityIndex(row));
+                                 }
+                             });
+
+        for (auto entityIndex : owners)
+        {
+            RemoveComponent<T>(entityIndex);
+        }
+    }
+
+    // 移除实体的所有组件
+    void RemoveEntityAllComponents(EntityIndexType entityIndex);
+
+    // 回调访问特定类型的所有组件
+    template <typename T>
+    void ForEachComponent(const std::function<void(T&)>& callback)
+    {
+        const auto TYPE = GetComponentTypeID<T>();
+
+        ForEachArchetypeWith(TYPE,
+                             [&callback, TYPE](Archetype& archetype)
+                             {
+                                 const size_t COLUMN = archetype.FindColumn(TYPE);
+
+                                 for (size_t chunk = 0; chunk < archetype.GetChunkCount(); ++chunk)
+                                 {
+                                     T*           components = archetype.GetChunkColumn<T>(COLUMN, chunk);
+                                     const size_t COUNT = archetype.GetChunkSize(chunk);
+
+                                     for (size_t slot = 0; slot < COUNT; ++slot)
+                                     {
+                                         callback(components[slot]);
+                                     }
+                                 }
+                             });
+    }
+
+    // 以Chunk为单位并行访问特定类型的所有组件，func的签名为void(T&)。grainSize为每段的组件数量，按Chunk向上取整
+    template <typename T, typename Func>
+    void ParallelForEachComponent(ThreadPool* pool, Func&& func, size_t grainSize = 0)
+    {
+        const auto CHUNKS = CollectChunks(GetComponentTypeID<T>());
+
+        const auto RANGE_FUNC = [&CHUNKS, &func](size_t begin, size_t end)
+        {
+            for (size_t index = begin; index < end; ++index)
+            {
+                const auto& [archetype, column, chunk] = CHUNKS[index];
+
+                T*           components = archetype->template GetChunkColumn<T>(column, chunk);
+                const size_t COUNT = archetype->GetChunkSize(chunk);
+
+                for (size_t slot = 0; slot < COUNT; ++slot)
+                {
+                    func(components[slot]);
+                }
+            }
+        };
+
+        if (pool != nullptr)
+        {
+            pool->ParallelFor(CHUNKS.size(), GetChunkGrain(CHUNKS, grainSize), RANGE_FUNC);
+        }
+        else
+        {
+            RANGE_FUNC(0, CHUNKS.size());
+        }
+    }
+
+    /**
+     * 以Chunk为单位并行归约特定类型的所有组件，每个Chunk得到一个partial，再按Chunk的顺序合并
+     *
+     * grainSize只决定每段包含的Chunk数量，partial始终按Chunk划分，因此结果与grainSize和线程数量都无关
+     */
+    template <typename T, typename TResult, typename MapFunc, typename ReduceFunc>
+    TResult ParallelReduceComponent(ThreadPool* pool, TResult identity, MapFunc&& map, ReduceFunc&& reduce,
+                                    size_t grainSize = 0)
+    {
+        const auto CHUNKS = CollectChunks(GetComponentTypeID<T>());
+
+        std::vector<TResult> partials(CHUNKS.size(), identity);
+
+        const auto RANGE_FUNC = [&CHUNKS, &partials, &map, &reduce](size_t begin, size_t end)
+        {
+            for (size_t index = begin; index < end; ++index)
+            {
+                const auto& [archetype, column, chunk] = CHUNKS[index];
+
+                T*           components = archetype->template GetChunkColumn<T>(column, chunk);
+                const size_t COUNT = archetype->GetChunkSize(chunk);
+
+                for (size_t slot = 0; slot < COUNT; ++slot)
+                {
+                    partials[index] = reduce(std::move(partials[index]), map(components[slot]));
+                }
+            }
+        };
+
+        if (pool != nullptr)
+        {
+            pool->ParallelFor(CHUNKS.size(), GetChunkGrain(CHUNKS, grainSize), RANGE_FUNC);
+        }
+        else
+        {
+            RANGE_FUNC(0, CHUNKS.size());
+        }
+
+        TResult result = std::move(identity);
+
+        for (auto& partial : partials)
+        {
+            result = reduce(std::move(result), std::move(partial));
+        }
+
+        return result;
+    }
+
+    // 按Chunk遍历同时拥有Ts...的所有实体，func的签名为void(EntityIndexType, Ts&...)
+    template <typename... Ts, typename Func>
+    void Each(Func&& func)
+    {
+        for (const auto& archetype : Archetypes)
+        {
+            const std::array<size_t, sizeof...(Ts)> COLUMNS{archetype->FindColumn(GetComponentTypeID<Ts>())...};
+
+            if (archetype->Size() == 0 || std::ranges::find(COLUMNS, Archetype::INVALID_COLUMN) != COLUMNS.end())
+            {
+                continue;
+            }
+
+            for (size_t chunk = 0; chunk < archetype->GetChunkCount(); ++chunk)
+            {
+                EachInChunk<Ts...>(*archetype, chunk, COLUMNS, func, std::index_sequence_for<Ts...>{});
+            }
+        }
+    }
+
+    // 是否没有存储任何实体
+    [[nodiscard]] bool IsEmpty() const;
+
+    // 原型数量
+    [[nodiscard]] size_t GetArchetypeCount() const;
+
+    // 所有原型已分配的Chunk的总字节数
+    [[nodiscard]] size_t GetChunkMemoryBytes() const;
+
+    // 清空所有原型
+    void Clear();
+
+private:
+    // 实体所在的原型及行号
+    struct EntityLocation final
+    {
+        Archetype* Owner = nullptr;
+        size_t     Row = 0;
+    };
+
+    // 获取实体所在的原型，不存在则返回nullptr
+    [[nodiscard]] Archetype* GetArchetype(EntityIndexType entityIndex) const;
+
+    // 获取或创建组件集合为types的原型
+    Archetype* GetOrCreateArchetype(std::vector<const ComponentTypeInfo*> types);
+
+    // 添加info后到达的原型
+    Archetype* GetAddTarget(Archetype* source, const ComponentTypeInfo* info);
+
+    // 移除typeID后到达的原型，若组件集合为空则返回nullptr
+    Archetype* GetRemoveTarget(Archetype* source, ComponentTypeID typeID);
+
+    // 将实体搬运到目标原型，返回新的行号。目标原型中新增的列不会被构造
+    size_t MoveEntity(EntityIndexType entityIndex, Archetype* target);
+
+    // 移除原型中的一行，并修正被搬运实体的位置
+    void RemoveRow(Archetype* owner, size_t row);
+
+    // 包含某种组件的一个Chunk
+    struct ChunkRef final
+    {
+        Archetype* Owner;
+        size_t     Column;
+        size_t     Chunk;
+    };
+
+    // 收集所有包含typeID的Chunk，顺序固定
+    [[nodiscard]] std::vector<ChunkRef> CollectChunks(ComponentTypeID typeID) const;
+
+    // 将组件数量的粒度换算为Chunk数量：按最大的Chunk容量向上取整，0表示每段一个Chunk
+    [[nodiscard]] static size_t GetChunkGrain(const std::vector<ChunkRef>& chunks, size_t grainSize);
+
+    // 遍历所有包含typeID的原型
+    template <typename Func>
+    void ForEachArchetypeWith(ComponentTypeID typeID, Func&& func)
+    {
+        for (const auto& archetype : Archetypes)
+        {
+            if (archetype->Size() != 0 && archetype->FindColumn(typeID) != Archetype::INVALID_COLUMN)
+            {
+                func(*archetype);
+            }
+        }
+    }
+
+    template <typename... Ts, typename Func, size_t... Is>
+    static void EachInChunk(const Archetype& archetype, size_t chunk, const std::array<size_t, sizeof...(Ts)>& columns,
+                            Func& func, std::index_sequence<Is...> /*unused*/)
+    {
+        const EntityIndexType* entities = archetype.GetChunkEntities(chunk);
+        const size_t           COUNT = archetype.GetChunkSize(chunk);
+
+        std::tuple<Ts*...> components{archetype.GetChunkColumn<Ts>(columns[Is], chunk)...};
+
+        for (size_t slot = 0; slot < COUNT; ++slot)
+        {
+            func(entities[slot], std::get<Is>(components)[slot]...);
+        }
+    }
+
+    // EntityIndex -> 实体所在位置
+    std::vector<EntityLocation> EntityLocations;
+
+    // 所有原型
+    std::vector<std::unique_ptr<Archetype>> Archetypes;
+
+    // 组件集合 -> 原型
+    std::map<std::vector<ComponentTypeID>, Archetype*> ArchetypeLookup;
+};
+
+} // namespace NekiraECS
@@ -0,0 +1,240 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <NekiraECS/Core/Component/ComponentManager.hpp>
+#include <NekiraECS/Core/Entity/Entity.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+namespace NekiraECS
+{
+class World;
+
+// 类型擦除后的组件命令信息，回放时通过它来添加、移除组件
+struct ComponentCommandInfo final
+{
+    ComponentTypeID ID;
+
+    // 将payload处的组件移动到entityIndex上
+    void (*Add)(ComponentManager& manager, void* payload, EntityIndexType entityIndex);
+
+    // 移除entityIndex上的组件
+    void (*Remove)(ComponentManager& manager, EntityIndexType entityIndex);
+
+    // 析构payload处的组件
+    void (*Destroy)(void* payload);
+
+    template <typename T>
+    static const ComponentCommandInfo* Get()
+    {
+        static const ComponentCommandInfo INFO{
+            .ID = GetComponentTypeID<T>(),
+            .Add = [](ComponentManager& manager, void* payload, EntityIndexType entityIndex)
+            { manager.AddComponent<T>(entityIndex, std::move(*static_cast<T*>(payload))); },
+            .Remove = [](ComponentManager& manager, EntityIndexType entityIndex)
+            { manager.RemoveComponent<T>(entityIndex); },
+            .Destroy = [](void* payload) { static_cast<T*>(payload)->~T(); }};
+
+        return &INFO;
+    }
+};
+
+// 命令类型
+enum class CommandType : uint8_t
+{
+    CreateEntity = 0,
+    DestroyEntity,
+    AddComponent,
+    RemoveComponent
+};
+
+} // namespace NekiraECS
+
+
+
+namespace NekiraECS
+{
+
+/**
+ * 命令缓冲：记录实体与组件的结构性修改，在同步点统一回放
+ *
+ * @[INFO] 记录逻辑：
+ *
+ * 1.每个线程拥有自己的命令流，命令连续写入固定大小的内存块中，记录时只有首次访问该缓冲的线程需要加锁。
+ * 2.CreateEntity立即返回一个延迟实体(版本号为0，不会与真实实体冲突)，可以作为后续命令的目标。
+ * 3.组件数据以移动构造的方式直接存放在命令流中，不产生额外的堆分配。
+ *
+ * @[INFO] 回放逻辑：
+ *
+ * 1.先执行所有CreateEntity，为每个延迟实体创建真实实体。
+ * 2.再按组件类型稳定排序后执行AddComponent/RemoveComponent，相同类型的命令集中执行，同一类型内保持记录顺序。
+ * 3.最后执行DestroyEntity。目标实体在回放时已失效的命令会被忽略。
+ * 4.回放开始时取走所有命令流，回放期间(例如在组件观察者中)记录的命令写入新的命令流，在下一次回放时执行。
+ *
+ * @[NOTE] 记录可以在多个线程上同时进行，但回放必须在没有其他线程记录时进行
+ */
+class CommandBuffer final
+{
+public:
+    CommandBuffer();
+    ~CommandBuffer();
+
+    CommandBuffer(const CommandBuffer&) = delete;
+    CommandBuffer(CommandBuffer&&) noexcept = delete;
+
+    CommandBuffer& operator=(const CommandBuffer&) = delete;
+    CommandBuffer& operator=(CommandBuffer&&) noexcept = delete;
+
+    // 记录创建实体，返回延迟实体，回放后该延迟实体会对应一个真实实体
+    [[nodiscard]] Entity CreateEntity();
+
+    // 记录销毁实体
+    void DestroyEntity(const Entity& entity);
+
+    // 记录添加组件，组件在记录时即构造并存放在命令流中
+    template <typename T, typename... Args>
+        requires ComponentType<T>
+    void AddComponent(const Entity& entity, Args&&... args)
+    {
+        static_assert(alignof(T) <= BLOCK_ALIGNMENT, "Component alignment exceeds the command block alignment");
+
+        // 先构造组件，构造抛出异常时不会留下未初始化的命令。与回放相同，之后的移动构造假定不会抛出异常
+        T component(std::forward<Args>(args)...);
+
+        void* payload = AllocateCommand(CommandType::AddComponent, entity, ComponentCommandInfo::Get<T>(), sizeof(T),
+                                        alignof(T));
+
+        ::new (payload) T(std::move(component));
+    }
+
+    // 记录移除组件
+    template <typename T>
+        requires ComponentType<T>
+    void RemoveComponent(const Entity& entity)
+    {
+        AllocateCommand(CommandType::RemoveComponent, entity, ComponentCommandInfo::Get<T>(), 0, 1);
+    }
+
+    // 在world上回放并清空所有命令，回放期间记录的命令保留到下一次回放
+    void Playback(World& world);
+
+    // 丢弃所有命令
+    void Clear();
+
+    // 是否没有任何命令
+    [[nodiscard]] bool IsEmpty() const;
+
+    // 是否为CommandBuffer创建的延迟实体
+    [[nodiscard]] static bool IsDeferred(const Entity& entity);
+
+    // 每个内存块的默认字节数
+    static constexpr size_t BLOCK_SIZE = 4 * 1024;
+
+    // 内存块的对齐，组件的对齐不能超过该值
+    static constexpr size_t BLOCK_ALIGNMENT = 64;
+
+private:
+    // 命令头，紧随其后的是组件数据
+    struct CommandHeader final
+    {
+        const ComponentCommandInfo* Info;
+
+        EntityIDType Target;
+
+        // 组件数据相对命令头的偏移，以及整条命令的字节数
+        uint32_t PayloadOffset;
+        uint32_t Size;
+
+        CommandType Type;
+    };
+
+    struct CommandBlock final
+    {
+        std::byte* Data;
+        size_t     Capacity;
+        size_t     Used;
+    };
+
+    // 单个线程的命令流
+    struct CommandStream final
+    {
+        std::vector<CommandBlock> Blocks;
+
+        // 当前写入的内存块
+        size_t Current = 0;
+
+        // 所属线程
+        std::thread::id Owner;
+    };
+
+    // 写入一条命令，返回组件数据的地址
+    void* AllocateCommand(CommandType type, const Entity& target, const ComponentCommandInfo* info, size_t payloadSize,
+                          size_t payloadAlign);
+
+    // 获取当前线程的命令流
+    CommandStream& GetLocalStream();
+
+    // 按写入顺序遍历streams中的所有命令
+    template <typename Func>
+    static void ForEachCommand(const std::vector<CommandStream*>& streams, Func&& func)
+    {
+        for (const auto* stream : streams)
+        {
+            for (const auto& block : stream->Blocks)
+            {
+                for (size_t offset = 0; offset < block.Used;)
+                {
+                    auto* header = std::launder(reinterpret_cast<CommandHeader*>(block.Data + offset));
+
+                    func(header);
+
+                    offset += header->Size;
+                }
+            }
+        }
+    }
+
+    // 重置所有命令流，内存块保留以便复用
+    void ResetStreams();
+
+    // 重置回放时取走的命令流，并按order的顺序交还给尚未创建新命令流的线程复用，其余的释放
+    void ReturnStreams(std::unordered_map<std::thread::id, std::unique_ptr<CommandStream>>& streams,
+                       const std::vector<CommandStream*>&                                   order);
+
+    // 释放命令流的所有内存块
+    static void FreeBlocks(CommandStream& stream);
+
+    // 用于区分不同的CommandBuffer实例，线程本地缓存依赖它来判断是否命中。回放取走命令流时会更换，使所有缓存失效
+    uint64_t BufferID;
+
+    std::mutex StreamMutex;
+
+    std::unordered_map<std::thread::id, std::unique_ptr<CommandStream>> Streams;
+
+    // 命令流的创建顺序，回放时按此顺序遍历
+    std::vector<CommandStream*> StreamOrder;
+
+    // 已分配的延迟实体数量
+    std::atomic<size_t> DeferredCount{0};
+
+    // 已记录的命令数量
+    std::atomic<size_t> CommandCount{0};
+};
+
+} // namespace NekiraECS
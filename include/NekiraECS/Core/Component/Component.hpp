@@ -9,6 +9,8 @@
 #pragma once
 
 #include <NekiraECS/Core/Primary/PrimaryType.hpp>
+#include <cstdint>
+#include <type_traits>
 #include <typeindex>
 
 
@@ -16,7 +18,62 @@
 namespace NekiraECS
 {
 
+/**
+ * 组件类型约束
+ *
+ * 任意可移动的非const对象类型都可以作为组件，不需要继承任何基类，例如：
+ * struct Position { float X, Y, Z; };
+ *
+ * 这样的组件没有虚表指针，可以是平凡可复制的，在ComponentArray中紧密排列。
+ */
+template <typename T>
+concept ComponentType = std::is_object_v<T> && !std::is_const_v<T> && !std::is_volatile_v<T> && !std::is_array_v<T>
+                        && std::is_move_constructible_v<T> && std::is_move_assignable_v<T>;
+
+// Ts...中是否没有重复的类型
+template <typename... Ts>
+struct TUniqueTypes : std::true_type
+{};
+
+template <typename T, typename... Ts>
+struct TUniqueTypes<T, Ts...> : std::bool_constant<(!std::is_same_v<T, Ts> && ...) && TUniqueTypes<Ts...>::value>
+{};
+
+
+// 组件类型ID，每种组件类型在首次使用时分配一个从0开始的稠密ID
+using ComponentTypeID = uint32_t;
+
+// 无效的组件类型ID
+constexpr ComponentTypeID INVALID_COMPONENT_TYPE_ID = UINT32_MAX;
+
+/**
+ * 组件变化的时间戳(Tick)，由SystemManager在每个系统分组开始前递增，初始值为1
+ *
+ * @[NOTE] 以每帧6个分组、60帧每秒计算，32位的Tick约138天后回绕
+ */
+using ComponentTick = uint32_t;
+
+// 组件类型ID分配器
+class ComponentTypeRegistry final
+{
+public:
+    // 分配下一个组件类型ID。计数器定义在Core模块中，保证所有组件类型共享同一个计数器
+    static ComponentTypeID NextID();
+
+    // 已分配的组件类型数量
+    static ComponentTypeID GetCount();
+};
+
+// 获取组件类型T的ID。每种类型只会分配一次，之后的调用只是读取一个静态变量
+template <ComponentType T>
+ComponentTypeID GetComponentTypeID()
+{
+    static const ComponentTypeID ID = ComponentTypeRegistry::NextID();
+    return ID;
+}
+
 // 组件接口基类
+// @[NOTE] Component<T>已不再继承该接口，这里仅为兼容旧代码而保留
 class IComponentBase
 {
 public:
@@ -32,14 +89,15 @@ public:
 };
 
 
-// CRTP模板组件类，其他的组件类通过继承该类来实现
+// CRTP模板组件类，可选的组件基类
+// 该类是一个空的非虚基类，不会增加组件的大小，也不会影响组件的平凡可复制性
 template <typename T>
-class Component : public IComponentBase
+class Component
 {
     friend T;
 
 public:
-    std::type_index GetTypeIndex() override
+    [[nodiscard]] std::type_index GetTypeIndex() const
     {
         return std::type_index(typeid(T));
     }
@@ -51,7 +109,7 @@ private:
     Component(Component&&) noexcept = default;
     Component& operator=(Component&&) noexcept = default;
 
-    virtual ~Component() = default;
+    ~Component() = default;
 };
 
 } // namespace NekiraECS
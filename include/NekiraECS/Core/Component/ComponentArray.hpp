@@ -9,26 +9,99 @@
 #pragma once
 
 #include <NekiraECS/Core/Component/Component.hpp>
+#include <NekiraECS/Core/Component/ComponentObserver.hpp>
+#include <NekiraECS/Core/Component/ComponentTracker.hpp>
+#include <NekiraECS/Core/Component/TagComponentStorage.hpp>
+#include <NekiraECS/Core/Component/SparseIndexArray.hpp>
+#include <NekiraECS/Core/Component/StableComponentStorage.hpp>
+#include <NekiraECS/Core/Memory/MemoryResource.hpp>
+#include <NekiraECS/Core/Memory/MemoryUsage.hpp>
+#include <NekiraECS/Tasks/ThreadPool.hpp>
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <span>
 #include <type_traits>
+#include <typeinfo>
 #include <vector>
 
 
 namespace NekiraECS
 {
 
+/**
+ * 组件排序方式
+ * - Full: 先计算排列再原地应用，O(NlogN)，适合无序的数据
+ * - Incremental: 插入排序，O(N + 逆序对数量)，适合几乎有序的数据，可以每帧执行以维持顺序
+ */
+enum class ComponentSortMode : uint8_t
+{
+    Full = 0,
+    Incremental
+};
+
+/**
+ * 拥有组件容器的组接口，组件容器在增删组件时通知它，使组内实体始终紧凑地排列在各容器的前部
+ *
+ * @[NOTE] 每个组件容器最多只能被一个组拥有
+ */
+class IComponentGroupBase
+{
+public:
+    IComponentGroupBase() = default;
+    IComponentGroupBase(const IComponentGroupBase&) = delete;
+    IComponentGroupBase(IComponentGroupBase&&) noexcept = delete;
+    IComponentGroupBase& operator=(const IComponentGroupBase&) = delete;
+    IComponentGroupBase& operator=(IComponentGroupBase&&) noexcept = delete;
+
+    virtual ~IComponentGroupBase() = default;
+
+    // 组件已添加到entityIndex上
+    virtual void OnComponentAdded(EntityIndexType entityIndex) = 0;
+
+    // entityIndex上的组件即将被移除
+    virtual void OnComponentRemoving(EntityIndexType entityIndex) = 0;
+
+    // 某个被拥有的组件容器已被清空
+    virtual void OnArrayCleared() = 0;
+
+    // 组内实体数量
+    [[nodiscard]] virtual size_t Size() const = 0;
+
+    // 所有被拥有的组件容器已恢复为组内实体数量为groupSize时的状态
+    virtual void OnArraysRestored(size_t groupSize) = 0;
+
+    // 被拥有的组件容器已被恢复为未知的状态，重新把同时拥有所有组件的实体移动到组内
+    virtual void Rebuild() = 0;
+};
+
+
+// 组件容器在某一时刻的状态，用于回滚
+class IComponentArrayState
+{
+public:
+    IComponentArrayState() = default;
+    IComponentArrayState(const IComponentArrayState&) = default;
+    IComponentArrayState(IComponentArrayState&&) noexcept = default;
+    IComponentArrayState& operator=(const IComponentArrayState&) = default;
+    IComponentArrayState& operator=(IComponentArrayState&&) noexcept = default;
+
+    virtual ~IComponentArrayState() = default;
+};
+
 // 组件容器接口
 class IComponentArrayBase
 {
 public:
     IComponentArrayBase() = default;
-    IComponentArrayBase(const IComponentArrayBase&) = default;
-    IComponentArrayBase(IComponentArrayBase&&) noexcept = default;
-    IComponentArrayBase& operator=(const IComponentArrayBase&) = default;
-    IComponentArrayBase& operator=(IComponentArrayBase&&) noexcept = default;
+    IComponentArrayBase(const IComponentArrayBase&) = delete;
+    IComponentArrayBase(IComponentArrayBase&&) noexcept = delete;
+    IComponentArrayBase& operator=(const IComponentArrayBase&) = delete;
+    IComponentArrayBase& operator=(IComponentArrayBase&&) noexcept = delete;
 
     virtual ~IComponentArrayBase() = default;
 
@@ -46,87 +119,467 @@ public:
 
     // 清空容器
     virtual void Clear() = 0;
+
+    // 获取紧凑集合中每个组件对应的实体索引。ComponentIndex -> EntityIndex
+    [[nodiscard]] virtual const std::pmr::vector<EntityIndexType>& GetEntityIndices() const = 0;
+
+    // 是否支持保存状态(组件可复制)
+    [[nodiscard]] virtual bool CanSaveState() const = 0;
+
+    // 保存当前状态。reuse为不再使用的旧状态，可以为空，其缓冲会被复用以避免重新分配。不支持时返回nullptr
+    [[nodiscard]] virtual std::shared_ptr<IComponentArrayState> SaveState(
+        std::shared_ptr<IComponentArrayState> reuse) const = 0;
+
+    /**
+     * 恢复为state保存时的状态，state为空时清空容器
+     *
+     * 变化追踪与观察者视为所有组件被移除后重新添加。拥有该容器的组不会被通知，由调用者恢复组的状态。
+     */
+    virtual void RestoreState(const IComponentArrayState* state) = 0;
+
+    // 统计容器的内存占用
+    [[nodiscard]] virtual ComponentMemoryUsage GetMemoryUsage() const = 0;
+
+    // 稳定地址存储的空闲槽位比例超过阈值时压缩，在同步点调用。压缩时返回true
+    virtual bool CompactIfFragmented() = 0;
+
+    /**
+     * 标记容器可能已被修改
+     *
+     * 增删、交换以及获取可变组件的接口都会标记，回滚快照据此跳过自上次保存以来未修改的容器。
+     * 只在未标记时写入，避免多个线程同时访问时反复写同一缓存行。
+     */
+    void MarkModified()
+    {
+        if (!Modified.load(std::memory_order_relaxed))
+        {
+            Modified.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    // 自上次ClearModified以来是否可能被修改
+    [[nodiscard]] bool IsModified() const
+    {
+        return Modified.load(std::memory_order_relaxed);
+    }
+
+    // 清除修改标记
+    void ClearModified()
+    {
+        Modified.store(false, std::memory_order_relaxed);
+    }
+
+    // 拥有该容器的组，没有则为nullptr
+    [[nodiscard]] IComponentGroupBase* GetOwnerGroup() const
+    {
+        return OwnerGroup;
+    }
+
+    void SetOwnerGroup(IComponentGroupBase* group)
+    {
+        OwnerGroup = group;
+    }
+
+    // 开启变化追踪，已开启时不做任何事。开启前已存在的组件的Tick视为0
+    void EnableChangeTracking(const ComponentTick* currentTick, const EntityManager* entityManager)
+    {
+        if (Tracker == nullptr)
+        {
+            Tracker = std::make_unique<ComponentTracker>(currentTick, entityManager, Size());
+        }
+    }
+
+    // 变化追踪，未开启时为nullptr
+    [[nodiscard]] ComponentTracker* GetTracker() const
+    {
+        return Tracker.get();
+    }
+
+    // 获取观察者列表，不存在则创建
+    ComponentObservers& GetOrCreateObservers(const EntityManager* entityManager)
+    {
+        if (Observers == nullptr)
+        {
+            Observers = std::make_unique<ComponentObservers>(entityManager);
+        }
+
+        return *Observers;
+    }
+
+    // 观察者列表，没有订阅过时为nullptr
+    [[nodiscard]] ComponentObservers* GetObservers() const
+    {
+        return Observers.get();
+    }
+
+protected:
+    IComponentGroupBase* OwnerGroup = nullptr;
+
+    std::unique_ptr<ComponentTracker> Tracker;
+
+    std::unique_ptr<ComponentObservers> Observers;
+
+    std::atomic<bool> Modified{true};
 };
 
-// 组件容器
+/**
+ * 组件容器
+ *
+ * 稀疏索引的页、紧凑数组都从构造时传入的memory_resource分配，变化追踪与观察者等按需创建的辅助结构仍使用默认分配器。
+ * 开启了稳定地址存储的组件(StableComponentType)使用StableComponentStorage，组件地址不随增删而改变。
+ */
 template <typename T>
-    requires std::is_base_of_v<Component<T>, T>
+    requires ComponentType<T>
 class ComponentArray final : public IComponentArrayBase
 {
 public:
-    ComponentArray() = default;
+    explicit ComponentArray(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : ComponentIndices(resource), Components(resource), EntityIndices(resource)
+    {}
+
+    // 容器使用的memory_resource
+    [[nodiscard]] std::pmr::memory_resource* GetMemoryResource() const
+    {
+        return EntityIndices.get_allocator().resource();
+    }
 
     // 添加组件
     template <typename... Args>
     void AddComponent(EntityIndexType entityIndex, Args&&... args)
     {
+        MarkModified();
+
         // 如果已存在，则替换
-        if (entityIndex < ComponentIndices.size())
-        {
-            if (ComponentIndices[entityIndex] == INVALID_COMPONENT_INDEX)
-            {
-                // 新的组件索引
-                auto compIndex = Components.size();
-                ComponentIndices[entityIndex] = compIndex;
+        const auto EXISTING = ComponentIndices.Get(entityIndex);
 
-                // 添加组件到Components
-                Components.emplace_back(std::forward<Args>(args)...);
+        if (EXISTING != INVALID_COMPONENT_INDEX)
+        {
+            Components[EXISTING] = T(std::forward<Args>(args)...);
 
-                // 记录该组件对应的实体索引
-                EntityIndices.push_back(entityIndex);
-            }
-            else
+            if (Tracker != nullptr)
             {
-                auto compIndex = ComponentIndices[entityIndex];
-                Components[compIndex] = T(std::forward<Args>(args)...);
+                Tracker->OnChanged(EXISTING, entityIndex);
             }
 
+            if (Observers != nullptr)
+            {
+                Observers->Notify(entityIndex, ComponentEventType::Replace, &Components[EXISTING]);
+            }
             return;
         }
 
         /**
          * @[INFO] 添加逻辑：
          *
-         * 1.当不存在该实体的组件时，即entityIndex >= ComponentIndices.size(),
-         * 这时我们新扩容了ComponentIndices给entityIndex。
-         *
-         * 2.新的组件索引是Components的当前大小，因此我们即将添加的组件会放在Components的末尾。
+         * 1.新的组件索引是Components的当前大小，因此我们即将添加的组件会放在Components的末尾。
          *
-         * 3.我们将ComponentIndices[entityIndex]设为新的组件索引
+         * 2.我们将ComponentIndices中entityIndex对应的值设为新的组件索引，ComponentIndices会按需分配该索引所在的页
          *
-         * 4.EntityIDs与Components同步更新，因此我们直接在EntityIndices末尾添加entityIndex
+         * 3.EntityIDs与Components同步更新，因此我们直接在EntityIndices末尾添加entityIndex
          */
 
-        // 确保实体索引在ComponentIndices范围内
-        ComponentIndices.resize(entityIndex + 1, INVALID_COMPONENT_INDEX);
-
         // 新组件的索引是Components的当前大小
-        auto compIndex = Components.size();
+        auto compIndex = static_cast<EntityIndexType>(Components.size());
 
         // 记录该实体索引对应的组件索引
-        ComponentIndices[entityIndex] = compIndex;
+        ComponentIndices.Set(entityIndex, compIndex);
 
         // 添加组件到Components
         Components.emplace_back(std::forward<Args>(args)...);
 
         // 记录该组件对应的实体索引
         EntityIndices.push_back(entityIndex);
+
+        UpdatePeakBytes();
+
+        // 先记录Tick，组交换位置时Tick会随之移动
+        if (Tracker != nullptr)
+        {
+            Tracker->OnAdded(entityIndex);
+        }
+
+        // 通知拥有该容器的组，组会把该实体交换到组的区间内
+        if (OwnerGroup != nullptr)
+        {
+            OwnerGroup->OnComponentAdded(entityIndex);
+        }
+
+        // 组可能已移动该组件，因此重新查找
+        if (Observers != nullptr)
+        {
+            Observers->Notify(entityIndex, ComponentEventType::Construct, &GetComponentUnchecked(entityIndex));
+        }
     }
 
-    // 获取组件，如果不存在则返回nullptr
+    /**
+     * 批量添加组件：entityIndices[i]对应components[i]，已拥有该组件的实体会被替换，重复的实体以后出现的为准
+     *
+     * @[INFO] 添加逻辑：
+     *
+     * 1.先一次性预留Components与EntityIndices的容量，再在一个循环中填充ComponentIndices。
+     * 2.当所有实体都是新实体且互不重复时，新组件与components的顺序完全一致，直接整段追加。
+     *   对于可平凡复制的组件，vector的区间插入会退化为一次memmove，EntityIndices同理。
+     * 3.否则按记录的来源逐个追加。
+     */
+    void InsertRange(std::span<const EntityIndexType> entityIndices, std::span<const T> components)
+        requires std::is_copy_constructible_v<T> && std::is_copy_assignable_v<T>
+    {
+        MarkModified();
+
+        const size_t COUNT = std::min(entityIndices.size(), components.size());
+        const size_t OLD_SIZE = Components.size();
+
+        Components.reserve(OLD_SIZE + COUNT);
+        EntityIndices.reserve(OLD_SIZE + COUNT);
+
+        // 新组件在components中的下标，只有出现替换时才需要记录
+        std::vector<size_t> sources;
+
+        bool   contiguous = true;
+        size_t newCount = 0;
+
+        for (size_t source = 0; source < COUNT; ++source)
+        {
+            const auto EXISTING = ComponentIndices.Get(entityIndices[source]);
+
+            if (EXISTING == INVALID_COMPONENT_INDEX)
+            {
+                ComponentIndices.Set(entityIndices[source], static_cast<EntityIndexType>(OLD_SIZE + newCount));
+
+                if (!contiguous)
+                {
+                    sources.push_back(source);
+                }
+
+                ++newCount;
+                continue;
+            }
+
+            if (contiguous)
+            {
+                contiguous = false;
+                sources.resize(newCount);
+                std::iota(sources.begin(), sources.end(), size_t{0});
+            }
+
+            if (EXISTING < OLD_SIZE)
+            {
+                Components[EXISTING] = components[source];
+
+                if (Tracker != nullptr)
+                {
+                    Tracker->OnChanged(EXISTING, entityIndices[source]);
+                }
+
+                if (Observers != nullptr)
+                {
+                    Observers->Notify(entityIndices[source], ComponentEventType::Replace, &Components[EXISTING]);
+                }
+            }
+            else
+            {
+                // 本批次中重复的实体
+                sources[EXISTING - OLD_SIZE] = source;
+            }
+        }
+
+        if (contiguous)
+        {
+            Components.insert(Components.end(), components.begin(), components.begin() + COUNT);
+            EntityIndices.insert(EntityIndices.end(), entityIndices.begin(), entityIndices.begin() + COUNT);
+        }
+        else
+        {
+            for (const size_t SOURCE : sources)
+            {
+                Components.push_back(components[SOURCE]);
+                EntityIndices.push_back(entityIndices[SOURCE]);
+            }
+        }
+
+        UpdatePeakBytes();
+
+        if (Tracker != nullptr)
+        {
+            for (size_t compIndex = OLD_SIZE; compIndex < EntityIndices.size(); ++compIndex)
+            {
+                Tracker->OnAdded(EntityIndices[compIndex]);
+            }
+        }
+
+        /**
+         * 通知拥有该容器的组。组只会把某个位置与组区间末尾(不大于该位置)交换，
+         * 因此按位置顺序遍历新组件时，被换到当前位置的元素一定已经处理过。
+         */
+        if (OwnerGroup != nullptr)
+        {
+            for (size_t compIndex = OLD_SIZE; compIndex < EntityIndices.size(); ++compIndex)
+            {
+                OwnerGroup->OnComponentAdded(EntityIndices[compIndex]);
+            }
+        }
+
+        // 组可能已移动新组件，因此按来源通知
+        if (Observers != nullptr)
+        {
+            const size_t NEW_COUNT = EntityIndices.size() - OLD_SIZE;
+
+            for (size_t index = 0; index < NEW_COUNT; ++index)
+            {
+                const auto ENTITY_INDEX = entityIndices[contiguous ? index : sources[index]];
+
+                Observers->Notify(ENTITY_INDEX, ComponentEventType::Construct, &GetComponentUnchecked(ENTITY_INDEX));
+            }
+        }
+    }
+
+    /**
+     * 以整段数据填充空容器(用于快照加载)：entityIndices[i]对应components[i]，调用者需保证实体索引互不重复
+     *
+     * components直接接管为紧凑集合(使用与容器相同的memory_resource时不复制)，只需重建稀疏索引。
+     * 容器非空或两者长度不一致时返回false。
+     */
+    bool AssignDense(std::span<const EntityIndexType> entityIndices, typename TComponentStorage<T>::Type&& components)
+    {
+        if (!Components.empty() || entityIndices.size() != components.size())
+        {
+            return false;
+        }
+
+        MarkModified();
+
+        Components = std::move(components);
+        EntityIndices.assign(entityIndices.begin(), entityIndices.end());
+
+        RebuildIndices(0);
+        UpdatePeakBytes();
+
+        const size_t COUNT = EntityIndices.size();
+
+        if (Tracker != nullptr)
+        {
+            for (size_t compIndex = 0; compIndex < COUNT; ++compIndex)
+            {
+                Tracker->OnAdded(EntityIndices[compIndex]);
+            }
+        }
+
+        // 组只会把某个位置与不大于它的位置交换，因此按位置顺序通知即可，参见InsertRange
+        if (OwnerGroup != nullptr)
+        {
+            for (size_t compIndex = 0; compIndex < COUNT; ++compIndex)
+            {
+                OwnerGroup->OnComponentAdded(EntityIndices[compIndex]);
+            }
+        }
+
+        if (Observers != nullptr)
+        {
+            for (size_t compIndex = 0; compIndex < COUNT; ++compIndex)
+            {
+                Observers->Notify(EntityIndices[compIndex], ComponentEventType::Construct, &Components[compIndex]);
+            }
+        }
+
+        return true;
+    }
+
+    // 获取组件，如果不存在则返回nullptr。开启变化追踪时视为修改
     T* GetComponent(EntityIndexType entityIndex)
     {
-        if (!HasComponent(entityIndex))
+        // 获取该实体对应的组件索引
+        auto compIndex = ComponentIndices.Get(entityIndex);
+
+        if (compIndex == INVALID_COMPONENT_INDEX)
         {
             return nullptr;
         }
 
-        // 获取该实体对应的组件索引
-        auto compIndex = ComponentIndices[entityIndex];
+        MarkModified();
+
+        if (Tracker != nullptr)
+        {
+            Tracker->OnChanged(compIndex, entityIndex);
+        }
 
         return &Components[compIndex];
     }
 
+    // 只读获取组件，如果不存在则返回nullptr。不会标记修改
+    [[nodiscard]] const T* ReadComponent(EntityIndexType entityIndex) const
+    {
+        auto compIndex = ComponentIndices.Get(entityIndex);
+
+        return compIndex != INVALID_COMPONENT_INDEX ? &Components[compIndex] : nullptr;
+    }
+
+    // 标记组件已被修改，未开启变化追踪或不存在该组件时不做任何事。不是线程安全的，不能在并行回调中调用
+    void MarkChanged(EntityIndexType entityIndex)
+    {
+        auto compIndex = ComponentIndices.Get(entityIndex);
+
+        if (compIndex != INVALID_COMPONENT_INDEX)
+        {
+            MarkModified();
+        }
+
+        if (Tracker != nullptr && compIndex != INVALID_COMPONENT_INDEX)
+        {
+            Tracker->OnChanged(compIndex, entityIndex);
+        }
+    }
+
+    /**
+     * 回调访问自sinceTick(含)以来添加(Added)或修改(Changed)的组件，func的签名为void(EntityIndexType, T&)
+     *
+     * 通常只遍历变化日志的尾部，开销与变化数量成正比。未开启变化追踪时不会访问任何组件。
+     * 回调中可以修改组件，但不可增删该类型的组件。
+     */
+    template <typename Func>
+    void ForEachSince(ComponentChangeKind kind, ComponentTick sinceTick, Func&& func)
+    {
+        if (Tracker == nullptr)
+        {
+            return;
+        }
+
+        MarkModified();
+
+        // 日志已被裁剪到sinceTick之后，退化为全量扫描
+        if (sinceTick < Tracker->GetLogFloor(kind))
+        {
+            const auto& ticks = Tracker->GetTicks(kind);
+
+            for (size_t compIndex = 0; compIndex < Components.size(); ++compIndex)
+            {
+                if (ticks[compIndex] >= sinceTick)
+                {
+                    func(EntityIndices[compIndex], Components[compIndex]);
+                }
+            }
+            return;
+        }
+
+        const auto& log = Tracker->GetLog(kind);
+
+        // 回调中的修改会向日志追加记录，因此按下标遍历，并只遍历到调用前的末尾
+        const size_t END = log.size();
+
+        auto begin = std::ranges::lower_bound(log, sinceTick, {}, &ComponentTracker::TickRecord::Tick);
+
+        for (auto position = static_cast<size_t>(begin - log.begin()); position < END; ++position)
+        {
+            const auto ENTITY_INDEX = log[position].EntityIndex;
+            const auto COMP_INDEX = ComponentIndices.Get(ENTITY_INDEX);
+
+            // 只报告组件最近一次变化对应的记录
+            if (COMP_INDEX != INVALID_COMPONENT_INDEX && Tracker->IsLatestRecord(kind, position, COMP_INDEX))
+            {
+                func(ENTITY_INDEX, Components[COMP_INDEX]);
+            }
+        }
+    }
+
     // 容器是否为空
     [[nodiscard]] bool IsEmpty() const override
     {
@@ -142,16 +595,35 @@ public:
     // 从特定Entity中移除该组件
     void RemoveComponent(EntityIndexType entityIndex) override
     {
-        if (!HasComponent(entityIndex))
+        if (!ComponentIndices.Contains(entityIndex))
         {
             return;
         }
 
+        MarkModified();
+
+        // 移除之前通知，观察者仍然可以访问该组件
+        if (Observers != nullptr)
+        {
+            Observers->Notify(entityIndex, ComponentEventType::Destroy, &GetComponentUnchecked(entityIndex));
+        }
+
+        // 先让组把该实体交换到组的区间外，这会改变它的组件索引
+        if (OwnerGroup != nullptr)
+        {
+            OwnerGroup->OnComponentRemoving(entityIndex);
+        }
+
         // 获取该实体对应的组件索引
-        auto compIndex = ComponentIndices[entityIndex];
+        auto compIndex = ComponentIndices.GetUnchecked(entityIndex);
+
+        if (Tracker != nullptr)
+        {
+            Tracker->OnRemoved(compIndex, entityIndex);
+        }
 
         // 获取最后一个组件的索引
-        auto lastCompIndex = Components.size() - 1;
+        auto lastCompIndex = static_cast<EntityIndexType>(Components.size() - 1);
 
         // 最后一个组件对应的实体索引
         auto lastEntityIndex = EntityIndices[lastCompIndex];
@@ -173,58 +645,602 @@ public:
 
         if (compIndex != lastCompIndex)
         {
-            Components[compIndex] = std::move(Components[lastCompIndex]);
+            if constexpr (STABLE_ADDRESS)
+            {
+                // 只交换槽位，末尾的组件不移动，被移除组件的槽位在pop_back时进入空闲列表
+                Components.SwapDense(compIndex, lastCompIndex);
+            }
+            else
+            {
+                Components[compIndex] = std::move(Components[lastCompIndex]);
+            }
 
             EntityIndices[compIndex] = lastEntityIndex;
 
-            ComponentIndices[lastEntityIndex] = compIndex;
+            ComponentIndices.Set(lastEntityIndex, compIndex);
         }
 
         // 移除末尾的重复元素
         Components.pop_back();
         EntityIndices.pop_back();
 
-        // 标记该实体不再拥有该组件
-        ComponentIndices[entityIndex] = INVALID_COMPONENT_INDEX;
+        // 标记该实体不再拥有该组件，该页为空时会被释放
+        ComponentIndices.Remove(entityIndex);
     }
 
 
     // 检查特定Entity是否拥有该组件
     [[nodiscard]] bool HasComponent(EntityIndexType entityIndex) override
     {
-        return entityIndex < ComponentIndices.size() && ComponentIndices[entityIndex] != INVALID_COMPONENT_INDEX;
+        return Contains(entityIndex);
+    }
+
+    // 检查特定Entity是否拥有该组件(非虚函数版本，供View等热路径内联使用)
+    [[nodiscard]] bool Contains(EntityIndexType entityIndex) const
+    {
+        return ComponentIndices.Contains(entityIndex);
+    }
+
+    // 获取组件，不做任何检查。调用者需保证该实体拥有该组件
+    T& GetComponentUnchecked(EntityIndexType entityIndex)
+    {
+        return Components[ComponentIndices.GetUnchecked(entityIndex)];
+    }
+
+    // 获取紧凑集合中每个组件对应的实体索引。ComponentIndex -> EntityIndex
+    [[nodiscard]] const std::pmr::vector<EntityIndexType>& GetEntityIndices() const override
+    {
+        return EntityIndices;
     }
 
     // 清空容器
     void Clear() override
     {
-        ComponentIndices.clear();
+        MarkModified();
+
+        if (Observers != nullptr)
+        {
+            for (size_t compIndex = 0; compIndex < Components.size(); ++compIndex)
+            {
+                Observers->Notify(EntityIndices[compIndex], ComponentEventType::Destroy, &Components[compIndex]);
+            }
+        }
+
+        if (Tracker != nullptr)
+        {
+            Tracker->OnCleared(EntityIndices);
+        }
+
+        ComponentIndices.Clear();
         Components.clear();
         EntityIndices.clear();
+
+        if (OwnerGroup != nullptr)
+        {
+            OwnerGroup->OnArrayCleared();
+        }
+    }
+
+    [[nodiscard]] bool CanSaveState() const override
+    {
+        return STATE_COPYABLE;
+    }
+
+    [[nodiscard]] std::shared_ptr<IComponentArrayState> SaveState(
+        std::shared_ptr<IComponentArrayState> reuse) const override
+    {
+        if constexpr (STATE_COPYABLE)
+        {
+            auto state = std::dynamic_pointer_cast<State>(std::move(reuse));
+
+            if (state == nullptr)
+            {
+                state = std::make_shared<State>();
+            }
+
+            // 复制赋值会复用state已有的容量，可平凡复制的组件退化为一次memmove
+            state->Components = Components;
+            state->EntityIndices = EntityIndices;
+
+            return state;
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+
+    void RestoreState(const IComponentArrayState* state) override
+    {
+        if constexpr (STATE_COPYABLE)
+        {
+            const auto* source = static_cast<const State*>(state);
+
+            if (source == nullptr)
+            {
+                Clear();
+                return;
+            }
+
+            MarkModified();
+
+            if (Observers != nullptr)
+            {
+                for (size_t compIndex = 0; compIndex < Components.size(); ++compIndex)
+                {
+                    Observers->Notify(EntityIndices[compIndex], ComponentEventType::Destroy, &Components[compIndex]);
+                }
+            }
+
+            if (Tracker != nullptr)
+            {
+                Tracker->OnCleared(EntityIndices);
+            }
+
+            Components = source->Components;
+            EntityIndices = source->EntityIndices;
+
+            ComponentIndices.Assign(EntityIndices);
+            UpdatePeakBytes();
+
+            if (Tracker != nullptr)
+            {
+                for (const auto ENTITY_INDEX : EntityIndices)
+                {
+                    Tracker->OnAdded(ENTITY_INDEX);
+                }
+            }
+
+            if (Observers != nullptr)
+            {
+                for (size_t compIndex = 0; compIndex < Components.size(); ++compIndex)
+                {
+                    Observers->Notify(EntityIndices[compIndex], ComponentEventType::Construct, &Components[compIndex]);
+                }
+            }
+        }
+    }
+
+    ComponentMemoryUsage GetMemoryUsage() const override
+    {
+        const size_t SIZE = EntityIndices.size();
+        const size_t SLOTS = ComponentIndices.GetPageCount() * SparseIndexArray::PAGE_SIZE;
+
+        ComponentMemoryUsage usage;
+        usage.TypeID = GetComponentTypeID<T>();
+        usage.Name = typeid(T).name();
+        usage.ComponentSize = COMPONENT_BYTES;
+        usage.Count = SIZE;
+        usage.Capacity = Components.capacity();
+        usage.DenseBytes = SIZE * COMPONENT_BYTES + SIZE * sizeof(EntityIndexType);
+        usage.SlackBytes = (Components.capacity() - SIZE) * COMPONENT_BYTES +
+                           (EntityIndices.capacity() - SIZE) * sizeof(EntityIndexType);
+        usage.SparseIndexBytes = ComponentIndices.GetMemoryBytes() + GetSlotIndexBytes();
+        usage.SparseIndexPages = ComponentIndices.GetPageCount();
+        usage.OccupancyRatio = SLOTS > 0 ? static_cast<double>(SIZE) / static_cast<double>(SLOTS) : 0.0;
+        usage.TrackingBytes = Tracker != nullptr ? Tracker->GetMemoryBytes() : 0;
+        usage.PeakBytes = std::max(PeakBytes, GetStorageBytes());
+
+        return usage;
+    }
+
+    bool CompactIfFragmented() override
+    {
+        if constexpr (STABLE_ADDRESS)
+        {
+            if (Components.ShouldCompact())
+            {
+                Components.Compact();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * 压缩稳定地址存储：按紧凑顺序重新排列组件并释放所有空洞，之后遍历是连续的
+     *
+     * 所有组件的地址都会改变，GetAddressEpoch()随之递增。
+     */
+    void Compact()
+        requires StableComponentType<T>
+    {
+        Components.Compact();
+    }
+
+    // 设置自动压缩的阈值(空闲槽位的比例)，不小于1时只在调用Compact()时压缩
+    void SetCompactionThreshold(double threshold)
+        requires StableComponentType<T>
+    {
+        Components.SetCompactionThreshold(threshold);
+    }
+
+    // 空闲槽位占已使用槽位的比例
+    [[nodiscard]] double GetFragmentation() const
+        requires StableComponentType<T>
+    {
+        return Components.GetFragmentation();
+    }
+
+    // 地址世代，变化时所有缓存的组件地址都应重新获取
+    [[nodiscard]] uint64_t GetAddressEpoch() const
+        requires StableComponentType<T>
+    {
+        return Components.GetAddressEpoch();
+    }
+
+    // 交换紧凑集合中两个位置的组件，并同步更新稀疏集合
+    void SwapDense(EntityIndexType lhs, EntityIndexType rhs)
+    {
+        if (lhs == rhs)
+        {
+            return;
+        }
+
+        MarkModified();
+
+        SwapRaw(lhs, rhs);
+
+        ComponentIndices.Set(EntityIndices[lhs], lhs);
+        ComponentIndices.Set(EntityIndices[rhs], rhs);
+    }
+
+    /**
+     * 按compare对紧凑集合原地排序，compare的签名为bool(const T&, const T&)，ComponentIndices同步更新
+     *
+     * 被组拥有的容器不能单独排序(会破坏组内的排列)，此时返回false。
+     */
+    template <typename Compare>
+    bool Sort(Compare&& compare, ComponentSortMode mode = ComponentSortMode::Full)
+    {
+        if (OwnerGroup != nullptr)
+        {
+            return false;
+        }
+
+        const size_t SIZE = Components.size();
+
+        if (SIZE < 2)
+        {
+            return true;
+        }
+
+        MarkModified();
+
+        if (mode == ComponentSortMode::Incremental)
+        {
+            // 插入排序：相邻交换，记录第一个发生变化的位置，最后只更新该位置之后的稀疏索引
+            size_t firstChanged = SIZE;
+
+            for (size_t index = 1; index < SIZE; ++index)
+            {
+                for (size_t current = index; current > 0 && compare(Components[current], Components[current - 1]);
+                     --current)
+                {
+                    SwapRaw(current, current - 1);
+                    firstChanged = std::min(firstChanged, current - 1);
+                }
+            }
+
+            RebuildIndices(firstChanged);
+            return true;
+        }
+
+        // 先对位置排序得到排列，再沿着置换环原地交换，每个组件最多移动一次
+        std::vector<EntityIndexType> order(SIZE);
+        std::iota(order.begin(), order.end(), EntityIndexType{0});
+
+        std::ranges::stable_sort(order, [this, &compare](EntityIndexType lhs, EntityIndexType rhs)
+                                 { return compare(Components[lhs], Components[rhs]); });
+
+        for (size_t start = 0; start < SIZE; ++start)
+        {
+            size_t current = start;
+
+            while (order[current] != start)
+            {
+                const size_t NEXT = order[current];
+
+                SwapRaw(current, NEXT);
+                order[current] = static_cast<EntityIndexType>(current);
+                current = NEXT;
+            }
+
+            order[current] = static_cast<EntityIndexType>(current);
+        }
+
+        RebuildIndices(0);
+        return true;
+    }
+
+    /**
+     * 按other的紧凑顺序重排：同时拥有两种组件的实体排在前部，且顺序与other一致，其余实体排在之后
+     *
+     * 适合让两个经常一起遍历的容器保持相同的顺序。被组拥有的容器返回false。
+     */
+    template <typename U>
+    bool SortAs(const ComponentArray<U>& other)
+    {
+        if (OwnerGroup != nullptr)
+        {
+            return false;
+        }
+
+        EntityIndexType position = 0;
+
+        for (const auto ENTITY_INDEX : other.GetEntityIndices())
+        {
+            const auto CURRENT = ComponentIndices.Get(ENTITY_INDEX);
+
+            if (CURRENT == INVALID_COMPONENT_INDEX)
+            {
+                continue;
+            }
+
+            // [0, position)已经就位，因此CURRENT >= position
+            SwapDense(CURRENT, position);
+            ++position;
+        }
+
+        return true;
+    }
+
+    // 获取实体在紧凑集合中的位置，调用者需保证该实体拥有该组件
+    [[nodiscard]] EntityIndexType GetDenseIndex(EntityIndexType entityIndex) const
+    {
+        return ComponentIndices.GetUnchecked(entityIndex);
+    }
+
+    // 紧凑集合的起始地址。标签组件只有一个共享实例，此时只有下标0有效。稳定地址存储不是连续的，不提供
+    [[nodiscard]] T* GetComponentData()
+        requires(!StableComponentType<T>)
+    {
+        MarkModified();
+        return Components.data();
+    }
+
+    // 紧凑集合的只读起始地址，不会标记修改
+    [[nodiscard]] const T* GetComponentData() const
+        requires(!StableComponentType<T>)
+    {
+        return Components.data();
     }
 
     // 回调访问所有组件
     void ForEachComponent(const std::function<void(T&)>& callback)
     {
+        MarkModified();
+
         for (auto& comp : Components)
         {
             callback(comp);
         }
     }
 
+    /**
+     * 并行回调访问所有组件，func的签名为void(T&)或bool(T&)
+     *
+     * Components按grainSize(0表示DEFAULT_GRAIN_SIZE)划分为若干段，每段的字节数是缓存行的整数倍。
+     * 紧凑数组只按alignof(T)对齐，因此相邻两段仍可能共享边界上的一条缓存行。
+     * pool为空时在当前线程上按顺序执行。
+     *
+     * @[NOTE] 变化追踪不是线程安全的，func中不能调用MarkChanged或GetComponent。
+     *         需要报告修改时令func返回bool，返回true的组件会在所有段执行完毕后由调用线程标记为已修改
+     */
+    template <typename Func>
+    void ParallelForEach(ThreadPool* pool, Func&& func, size_t grainSize = 0)
+    {
+        MarkModified();
+
+        const size_t GRAIN = AlignGrainSize(grainSize);
+        const size_t COUNT = Components.size();
+
+        if constexpr (std::is_same_v<std::invoke_result_t<Func&, T&>, bool>)
+        {
+            if (Tracker != nullptr)
+            {
+                // 每段记录自己的修改，合并时按段的顺序写入日志，与线程数量无关
+                std::vector<std::vector<size_t>> changed((COUNT + GRAIN - 1) / GRAIN);
+
+                const auto TRACKED_FUNC = [this, &func, &changed, GRAIN](size_t begin, size_t end)
+                {
+                    auto& rangeChanged = changed[begin / GRAIN];
+
+                    for (size_t compIndex = begin; compIndex < end; ++compIndex)
+                    {
+                        if (func(Components[compIndex]))
+                        {
+                            rangeChanged.push_back(compIndex);
+                        }
+                    }
+                };
+
+                RunRanges(pool, COUNT, GRAIN, TRACKED_FUNC);
+
+                for (const auto& rangeChanged : changed)
+                {
+                    for (const size_t COMP_INDEX : rangeChanged)
+                    {
+                        Tracker->OnChanged(COMP_INDEX, EntityIndices[COMP_INDEX]);
+                    }
+                }
+
+                return;
+            }
+        }
+
+        const auto RANGE_FUNC = [this, &func](size_t begin, size_t end)
+        {
+            for (size_t compIndex = begin; compIndex < end; ++compIndex)
+            {
+                func(Components[compIndex]);
+            }
+        };
+
+        RunRanges(pool, COUNT, GRAIN, RANGE_FUNC);
+    }
+
+    /**
+     * 并行归约所有组件：每段内部计算partial = reduce(partial, map(component))，再按段的顺序合并所有partial
+     *
+     * 分段只取决于组件数量与grainSize，与线程数量无关，因此相同的输入总能得到相同的结果(包括浮点数)。
+     * identity需为reduce的单位元。pool为空时在当前线程上按相同的分段顺序执行。
+     */
+    template <typename TResult, typename MapFunc, typename ReduceFunc>
+    TResult ParallelReduce(ThreadPool* pool, TResult identity, MapFunc&& map, ReduceFunc&& reduce, size_t grainSize = 0)
+    {
+        MarkModified();
+
+        const size_t GRAIN = AlignGrainSize(grainSize);
+        const size_t COUNT = Components.size();
+        const size_t RANGE_COUNT = (COUNT + GRAIN - 1) / GRAIN;
+
+        std::vector<TResult> partials(RANGE_COUNT, identity);
+
+        const auto RANGE_FUNC = [this, &partials, &map, &reduce, GRAIN](size_t begin, size_t end)
+        {
+            auto& partial = partials[begin / GRAIN];
+
+            for (size_t compIndex = begin; compIndex < end; ++compIndex)
+            {
+                partial = reduce(std::move(partial), map(Components[compIndex]));
+            }
+        };
+
+        RunRanges(pool, COUNT, GRAIN, RANGE_FUNC);
+
+        // 按固定顺序合并
+        TResult result = std::move(identity);
+
+        for (auto& partial : partials)
+        {
+            result = reduce(std::move(result), std::move(partial));
+        }
+
+        return result;
+    }
+
+    // 并行遍历的默认粒度(组件数量)
+    static constexpr size_t DEFAULT_GRAIN_SIZE = 4096;
+
 
 private:
-    // 定义无效的组件索引
-    static constexpr size_t INVALID_COMPONENT_INDEX = -1;
+    // 交换紧凑集合中两个位置的组件与实体索引，不更新稀疏集合。稳定地址存储只交换槽位
+    void SwapRaw(size_t lhs, size_t rhs)
+    {
+        using std::swap;
+
+        if constexpr (STABLE_ADDRESS)
+        {
+            Components.SwapDense(lhs, rhs);
+        }
+        else
+        {
+            swap(Components[lhs], Components[rhs]);
+        }
+
+        swap(EntityIndices[lhs], EntityIndices[rhs]);
+
+        if (Tracker != nullptr)
+        {
+            Tracker->Swap(lhs, rhs);
+        }
+    }
+
+    // 根据EntityIndices重建[begin, Size())的稀疏索引
+    void RebuildIndices(size_t begin)
+    {
+        for (size_t compIndex = begin; compIndex < EntityIndices.size(); ++compIndex)
+        {
+            ComponentIndices.Set(EntityIndices[compIndex], static_cast<EntityIndexType>(compIndex));
+        }
+    }
+
+    // 将[0, count)按grain划分为若干段执行rangeFunc，pool为空时在当前线程上按段的顺序执行
+    template <typename RangeFunc>
+    static void RunRanges(ThreadPool* pool, size_t count, size_t grain, const RangeFunc& rangeFunc)
+    {
+        if (pool != nullptr)
+        {
+            pool->ParallelFor(count, grain, rangeFunc);
+            return;
+        }
+
+        for (size_t begin = 0; begin < count; begin += grain)
+        {
+            rangeFunc(begin, std::min(begin + grain, count));
+        }
+    }
+
+    // 将粒度向上取整，使每段的字节数为缓存行的整数倍
+    static size_t AlignGrainSize(size_t grainSize)
+    {
+        constexpr size_t CACHE_LINE = 64;
+        constexpr size_t ELEMENTS_PER_LINE = CACHE_LINE / std::gcd(sizeof(T), CACHE_LINE);
+
+        grainSize = grainSize == 0 ? DEFAULT_GRAIN_SIZE : grainSize;
+
+        return (grainSize + ELEMENTS_PER_LINE - 1) / ELEMENTS_PER_LINE * ELEMENTS_PER_LINE;
+    }
 
-    // 稀疏集合：每个实体索引对应的组件索引。EntityIndex -> ComponentIndex
-    std::vector<size_t> ComponentIndices;
+    // 紧凑数组与稀疏索引已分配的字节数
+    [[nodiscard]] size_t GetStorageBytes() const
+    {
+        return Components.capacity() * COMPONENT_BYTES + EntityIndices.capacity() * sizeof(EntityIndexType) +
+               ComponentIndices.GetMemoryBytes() + GetSlotIndexBytes();
+    }
 
-    // 紧凑集合：每个组件索引对应的组件实例。ComponentIndex -> Component
-    std::vector<T> Components;
+    // 稳定地址存储的槽位表与空闲列表的字节数，其余存储为0
+    [[nodiscard]] size_t GetSlotIndexBytes() const
+    {
+        if constexpr (STABLE_ADDRESS)
+        {
+            return Components.GetIndexBytes();
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    // 在可能扩容之后记录峰值
+    void UpdatePeakBytes()
+    {
+        PeakBytes = std::max(PeakBytes, GetStorageBytes());
+    }
+
+    // 是否使用稳定地址存储
+    static constexpr bool STABLE_ADDRESS = StableComponentType<T>;
+
+    // 单个组件占用的字节数，标签组件不占用存储
+    static constexpr size_t COMPONENT_BYTES = TagComponentType<T> ? 0 : sizeof(T);
+
+    // 组件是否可复制，不可复制的组件不支持保存状态
+    static constexpr bool STATE_COPYABLE = std::is_copy_constructible_v<T> && std::is_copy_assignable_v<T>;
+
+    // 保存的状态：紧凑集合的副本，稀疏索引在恢复时重建
+    struct State final : IComponentArrayState
+    {
+        typename TComponentStorage<T>::Type Components;
+
+        std::pmr::vector<EntityIndexType> EntityIndices;
+    };
+
+    // 定义无效的组件索引。组件数量不会超过实体数量，因此组件索引与实体索引使用相同的宽度
+    static constexpr EntityIndexType INVALID_COMPONENT_INDEX = SparseIndexArray::INVALID_VALUE;
+
+    // 稀疏集合(分页)：每个实体索引对应的组件索引。EntityIndex -> ComponentIndex
+    SparseIndexArray ComponentIndices;
+
+    // 紧凑集合：每个组件索引对应的组件实例。ComponentIndex -> Component。标签组件不占用任何存储
+    typename TComponentStorage<T>::Type Components;
 
     // 紧凑集合：每个组件索引对应的实体索引。ComponentIndex -> EntityIndex
-    std::vector<EntityIndexType> EntityIndices;
+    std::pmr::vector<EntityIndexType> EntityIndices;
+
+    // 紧凑数组与稀疏索引的最大占用(字节)
+    size_t PeakBytes = 0;
 };
 
 
@@ -234,9 +1250,7 @@ struct ComponentArrayHandle final
     ComponentArrayHandle() : Ptr(nullptr)
     {}
 
-    template <typename T>
-        requires std::is_base_of_v<Component<T>, T>
-    ComponentArrayHandle(std::unique_ptr<ComponentArray<T>> ptr) : Ptr(std::move(ptr))
+    explicit ComponentArrayHandle(TResourcePtr<IComponentArrayBase> ptr) : Ptr(std::move(ptr))
     {}
 
     ComponentArrayHandle(const ComponentArrayHandle&) = delete;
@@ -266,22 +1280,29 @@ struct ComponentArrayHandle final
         return Ptr.get();
     }
 
+    // 是否持有组件容器
+    [[nodiscard]] bool IsValid() const
+    {
+        return Ptr != nullptr;
+    }
+
     template <typename T>
-        requires std::is_base_of_v<Component<T>, T>
+        requires ComponentType<T>
     ComponentArray<T>* As() const
     {
         return static_cast<ComponentArray<T>*>(Ptr.get());
     }
 
 private:
-    std::unique_ptr<IComponentArrayBase> Ptr;
+    TResourcePtr<IComponentArrayBase> Ptr;
 };
 
+// 在resource上创建组件容器，容器本身与其存储都从resource分配
 template <typename T>
-    requires std::is_base_of_v<Component<T>, T>
-ComponentArrayHandle MakeComponentArrayHandle()
+    requires ComponentType<T>
+ComponentArrayHandle MakeComponentArrayHandle(std::pmr::memory_resource* resource)
 {
-    return ComponentArrayHandle(std::make_unique<ComponentArray<T>>());
+    return ComponentArrayHandle(MakeResourcePtr<ComponentArray<T>, IComponentArrayBase>(resource, resource));
 }
 
 } // namespace NekiraECS
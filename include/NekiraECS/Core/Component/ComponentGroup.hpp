@@ -0,0 +1,168 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <NekiraECS/Core/Component/ComponentArray.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+
+namespace NekiraECS
+{
+
+/**
+ * 拥有型组：拥有Ts...的所有组件容器，把同时拥有Ts...的实体紧凑地排列在每个容器的前部，且顺序一致
+ *
+ * @[INFO] 维护逻辑：
+ *
+ * 1.组内实体在每个容器中都位于[0, GroupSize)，且同一位置对应同一个实体，因此遍历组只需对N个数组做线性遍历。
+ * 2.添加组件后，若该实体已拥有所有组件，则在每个容器中把它与位置GroupSize的元素交换，然后GroupSize + 1。
+ * 3.移除组件前，若该实体在组内，则GroupSize - 1，并在每个容器中把它与位置GroupSize的元素交换，
+ *   之后组件容器的swap-and-pop只会影响组区间之外的元素。
+ */
+template <typename... Ts>
+    requires(sizeof...(Ts) > 1) && (ComponentType<Ts> && ...) && TUniqueTypes<Ts...>::value
+            && (!StableComponentType<Ts> && ...)
+class ComponentGroup final : public IComponentGroupBase
+{
+public:
+    // 接管所有组件容器，并把已同时拥有Ts...的实体移动到组内。调用者需保证这些容器未被其他组拥有
+    explicit ComponentGroup(ComponentArray<Ts>*... arrays) : Arrays(arrays...)
+    {
+        (arrays->SetOwnerGroup(this), ...);
+
+        Rebuild();
+    }
+
+    ~ComponentGroup() override
+    {
+        std::apply([](auto*... arrays) { (arrays->SetOwnerGroup(nullptr), ...); }, Arrays);
+    }
+
+    ComponentGroup(const ComponentGroup&) = delete;
+    ComponentGroup(ComponentGroup&&) noexcept = delete;
+
+    ComponentGroup& operator=(const ComponentGroup&) = delete;
+    ComponentGroup& operator=(ComponentGroup&&) noexcept = delete;
+
+    void OnComponentAdded(EntityIndexType entityIndex) override
+    {
+        if (!ContainsAll(entityIndex) || IsInGroup(entityIndex))
+        {
+            return;
+        }
+
+        MoveTo(entityIndex, static_cast<EntityIndexType>(GroupSize));
+        ++GroupSize;
+    }
+
+    void OnComponentRemoving(EntityIndexType entityIndex) override
+    {
+        if (!IsInGroup(entityIndex))
+        {
+            return;
+        }
+
+        --GroupSize;
+        MoveTo(entityIndex, static_cast<EntityIndexType>(GroupSize));
+    }
+
+    void OnArrayCleared() override
+    {
+        GroupSize = 0;
+    }
+
+    void OnArraysRestored(size_t groupSize) override
+    {
+        GroupSize = groupSize;
+    }
+
+    void Rebuild() override
+    {
+        GroupSize = 0;
+
+        // 以最小的容器为驱动，按位置顺序处理，被交换到当前位置的元素一定已经处理过
+        const std::pmr::vector<EntityIndexType>* driver = nullptr;
+
+        const auto SELECT_DRIVER = [&driver](const auto* array)
+        {
+            if (driver == nullptr || array->Size() < driver->size())
+            {
+                driver = &array->GetEntityIndices();
+            }
+        };
+
+        std::apply([&SELECT_DRIVER](const auto*... arrays) { (SELECT_DRIVER(arrays), ...); }, Arrays);
+
+        for (size_t position = 0; position < driver->size(); ++position)
+        {
+            OnComponentAdded((*driver)[position]);
+        }
+    }
+
+    // 组内实体数量
+    [[nodiscard]] size_t Size() const override
+    {
+        return GroupSize;
+    }
+
+    // 组内实体的实体索引，前Size()个有效
+    [[nodiscard]] const EntityIndexType* GetEntityIndices() const
+    {
+        return std::get<0>(Arrays)->GetEntityIndices().data();
+    }
+
+    // 组内T组件的起始地址，前Size()个有效，且与GetEntityIndices()一一对应。标签组件只有下标0有效
+    template <typename T>
+    [[nodiscard]] T* GetComponentData() const
+    {
+        return std::get<ComponentArray<T>*>(Arrays)->GetComponentData();
+    }
+
+    // 组件类型ID(已排序)，用于识别相同的组
+    [[nodiscard]] static std::vector<ComponentTypeID> GetTypeIDs()
+    {
+        std::vector<ComponentTypeID> typeIDs{GetComponentTypeID<Ts>()...};
+        std::ranges::sort(typeIDs);
+        return typeIDs;
+    }
+
+private:
+    // 是否拥有所有组件
+    [[nodiscard]] bool ContainsAll(EntityIndexType entityIndex) const
+    {
+        return std::apply([entityIndex](const auto*... arrays) { return (arrays->Contains(entityIndex) && ...); },
+                          Arrays);
+    }
+
+    // 是否在组内，调用者需保证该实体拥有所有组件或至少拥有第一个组件
+    [[nodiscard]] bool IsInGroup(EntityIndexType entityIndex) const
+    {
+        const auto* first = std::get<0>(Arrays);
+
+        return first->Contains(entityIndex) && first->GetDenseIndex(entityIndex) < GroupSize;
+    }
+
+    // 在每个容器中把entityIndex交换到position
+    void MoveTo(EntityIndexType entityIndex, EntityIndexType position)
+    {
+        std::apply([entityIndex, position](auto*... arrays)
+                   { (arrays->SwapDense(arrays->GetDenseIndex(entityIndex), position), ...); },
+                   Arrays);
+    }
+
+    std::tuple<ComponentArray<Ts>*...> Arrays;
+
+    // 组内实体数量
+    size_t GroupSize = 0;
+};
+
+} // namespace NekiraECS
@@ -8,135 +8,439 @@
 
 #pragma once
 
+#include <NekiraECS/Core/Archetype/ArchetypeStorage.hpp>
 #include <NekiraECS/Core/Component/ComponentArray.hpp>
-#include <unordered_map>
+#include <NekiraECS/Core/Component/ComponentGroup.hpp>
+#include <memory_resource>
+#include <span>
+#include <typeindex>
+#include <typeinfo>
 #include <utility>
+#include <vector>
 
 
 namespace NekiraECS
 {
-// 组件管理器
+
+/**
+ * 组件存储后端
+ * - SparseSet: 每种组件类型一个ComponentArray(稀疏集合)，默认后端
+ * - Archetype: 拥有相同组件集合的实体存放在同一个原型的Chunk中，适合同时读取多种组件的系统
+ */
+enum class ComponentStorageMode : uint8_t
+{
+    SparseSet = 0,
+    Archetype
+};
+
+class World;
+class WorldSnapshot;
+class SnapshotRing;
+
+// 组件管理器，每个World拥有一个
 class ComponentManager final
 {
+    friend class World;
+    friend class WorldSnapshot;
+    friend class SnapshotRing;
+
 public:
+    // 获取默认World的组件管理器
     static ComponentManager& Get();
 
+    // 设置组件存储后端，仅在没有存储任何组件时才能切换，切换成功返回true
+    bool SetStorageMode(ComponentStorageMode mode);
+
+    // 获取组件存储后端
+    [[nodiscard]] ComponentStorageMode GetStorageMode() const;
+
+    // 获取原型存储，仅在Archetype模式下有数据
+    ArchetypeStorage& GetArchetypeStorage();
+
+    // 统计每种组件类型与所有类型合计的内存占用
+    [[nodiscard]] ComponentManagerMemoryUsage GetMemoryUsage() const;
+
     // 添加组件
     template <typename T, typename... Args>
-        requires std::is_base_of_v<Component<T>, T>
+        requires ComponentType<T>
     void AddComponent(EntityIndexType entityIndex, Args&&... args)
     {
-        auto compTypeIndex = std::type_index(typeid(T));
-
-        // 如果该类型的组件数组不存在，则创建一个新的
-        if (!ComponentArrays.contains(compTypeIndex))
+        if (StorageMode == ComponentStorageMode::Archetype)
         {
-            auto handle = MakeComponentArrayHandle<T>();
-            ComponentArrays[compTypeIndex] = std::move(handle);
+            Archetypes.AddComponent<T>(entityIndex, std::forward<Args>(args)...);
+            return;
         }
 
-        auto* compArray = ComponentArrays[compTypeIndex].As<T>();
+        GetOrCreateComponentArray<T>()->AddComponent(entityIndex, std::forward<Args>(args)...);
+    }
+
+    // 批量添加组件，entityIndices[i]对应components[i]。SparseSet模式下一次性预留容量并整段追加
+    template <typename T>
+        requires ComponentType<T> && std::is_copy_constructible_v<T> && std::is_copy_assignable_v<T>
+    void AddComponents(std::span<const EntityIndexType> entityIndices, std::span<const T> components)
+    {
+        if (StorageMode == ComponentStorageMode::Archetype)
+        {
+            const size_t COUNT = std::min(entityIndices.size(), components.size());
+
+            for (size_t index = 0; index < COUNT; ++index)
+            {
+                Archetypes.AddComponent<T>(entityIndices[index], components[index]);
+            }
+            return;
+        }
 
-        compArray->AddComponent(entityIndex, std::forward<Args>(args)...);
+        GetOrCreateComponentArray<T>()->InsertRange(entityIndices, components);
     }
 
     // 获取组件，如果不存在或实体无效则返回nullptr
     template <typename T>
-        requires std::is_base_of_v<Component<T>, T>
+        requires ComponentType<T>
     T* GetComponent(EntityIndexType entityIndex)
     {
-        auto compTypeIndex = std::type_index(typeid(T));
+        if (StorageMode == ComponentStorageMode::Archetype)
+        {
+            return Archetypes.GetComponent<T>(entityIndex);
+        }
+
+        auto* compArray = GetComponentArray<T>();
+
+        return compArray != nullptr ? compArray->GetComponent(entityIndex) : nullptr;
+    }
 
-        if (!ComponentArrays.contains(compTypeIndex))
+    // 只读获取组件，不会标记修改。如果不存在则返回nullptr
+    template <typename T>
+        requires ComponentType<T>
+    const T* ReadComponent(EntityIndexType entityIndex)
+    {
+        if (StorageMode == ComponentStorageMode::Archetype)
         {
-            return nullptr;
+            return Archetypes.GetComponent<T>(entityIndex);
         }
 
-        auto* compArray = ComponentArrays[compTypeIndex].As<T>();
+        const auto* compArray = FindComponentArray<T>();
 
-        return compArray->GetComponent(entityIndex);
+        return compArray != nullptr ? compArray->ReadComponent(entityIndex) : nullptr;
     }
 
-    // 是否拥有该组件
+    // 标记组件已被修改(仅对开启了变化追踪的组件类型有效)
     template <typename T>
-        requires std::is_base_of_v<Component<T>, T>
-    [[nodiscard]] bool HasComponent(EntityIndexType entityIndex)
+        requires ComponentType<T>
+    void MarkChanged(EntityIndexType entityIndex)
     {
-        auto compTypeIndex = std::type_index(typeid(T));
+        if (auto* compArray = GetComponentArray<T>())
+        {
+            compArray->MarkChanged(entityIndex);
+        }
+    }
 
-        if (!ComponentArrays.contains(compTypeIndex))
+    /**
+     * 为特定组件类型开启变化追踪(仅SparseSet模式)，Archetype模式下返回false
+     *
+     * 开启后容器为每个组件记录添加与修改的Tick，并记录移除日志。通过GetComponent获取可变指针、替换组件视为修改，
+     * 视图与Each提供的引用不会自动标记，需要时调用MarkChanged。ParallelForEach的回调可以返回bool报告修改，
+     * 由调用线程在并行执行结束后统一标记，回调中不能调用MarkChanged。
+     */
+    template <typename T>
+        requires ComponentType<T>
+    bool EnableChangeTracking()
+    {
+        if (StorageMode == ComponentStorageMode::Archetype)
         {
             return false;
         }
 
-        return ComponentArrays[compTypeIndex]->HasComponent(entityIndex);
+        GetOrCreateComponentArray<T>()->EnableChangeTracking(&CurrentTick, EntitySource);
+        return true;
+    }
+
+    // 获取特定组件类型的观察者列表，不存在则创建(仅SparseSet模式)，Archetype模式下返回nullptr
+    template <typename T>
+        requires ComponentType<T>
+    ComponentObservers* GetOrCreateObservers()
+    {
+        if (StorageMode == ComponentStorageMode::Archetype)
+        {
+            return nullptr;
+        }
+
+        return &GetOrCreateComponentArray<T>()->GetOrCreateObservers(EntitySource);
+    }
+
+    // 把所有组件类型缓冲的生命周期事件分发给批量观察者。由SystemManager在每个系统分组结束后调用
+    void FlushComponentEvents();
+
+    // 获取当前Tick
+    [[nodiscard]] ComponentTick GetCurrentTick() const;
+
+    // 递增Tick，并裁剪所有变化追踪的日志。由SystemManager在每个系统分组开始前调用
+    void AdvanceTick();
+
+    // 是否拥有该组件
+    template <typename T>
+        requires ComponentType<T>
+    [[nodiscard]] bool HasComponent(EntityIndexType entityIndex)
+    {
+        if (StorageMode == ComponentStorageMode::Archetype)
+        {
+            return Archetypes.HasComponent<T>(entityIndex);
+        }
+
+        const auto* compArray = FindComponentArray<T>();
+
+        return compArray != nullptr && compArray->Contains(entityIndex);
     }
 
     // 移除Entity的某个组件
     template <typename T>
-        requires std::is_base_of_v<Component<T>, T>
+        requires ComponentType<T>
     void RemoveComponent(EntityIndexType entityIndex)
     {
-        auto compTypeIndex = std::type_index(typeid(T));
-
-        if (!ComponentArrays.contains(compTypeIndex))
+        if (StorageMode == ComponentStorageMode::Archetype)
         {
+            Archetypes.RemoveComponent<T>(entityIndex);
             return;
         }
 
-        ComponentArrays[compTypeIndex]->RemoveComponent(entityIndex);
+        if (auto* compArray = GetComponentArray<T>())
+        {
+            compArray->RemoveComponent(entityIndex);
+        }
+    }
+
+    // 按compare对特定类型的组件原地排序(仅SparseSet模式)，被组拥有或不支持时返回false
+    template <typename T, typename Compare>
+        requires ComponentType<T>
+    bool SortComponents(Compare&& compare, ComponentSortMode mode = ComponentSortMode::Full)
+    {
+        if (StorageMode == ComponentStorageMode::Archetype)
+        {
+            return false;
+        }
+
+        auto* compArray = GetComponentArray<T>();
+
+        return compArray == nullptr || compArray->Sort(std::forward<Compare>(compare), mode);
+    }
+
+    // 按U的紧凑顺序重排T(仅SparseSet模式)，被组拥有或不支持时返回false
+    template <typename T, typename U>
+        requires ComponentType<T> && ComponentType<U>
+    bool SortComponentsAs()
+    {
+        if (StorageMode == ComponentStorageMode::Archetype)
+        {
+            return false;
+        }
+
+        auto* compArray = GetComponentArray<T>();
+        auto* otherArray = GetComponentArray<U>();
+
+        if (compArray == nullptr || otherArray == nullptr)
+        {
+            return true;
+        }
+
+        return compArray->SortAs(*otherArray);
+    }
+
+    // 压缩T的稳定地址存储(仅SparseSet模式)，所有T组件的地址都会改变
+    template <typename T>
+        requires StableComponentType<T>
+    void CompactComponents()
+    {
+        if (auto* compArray = GetComponentArray<T>())
+        {
+            compArray->Compact();
+        }
+    }
+
+    // 设置T的稳定地址存储在同步点自动压缩的阈值(仅SparseSet模式)，不小于1时只在CompactComponents时压缩
+    template <typename T>
+        requires StableComponentType<T>
+    bool SetCompactionThreshold(double threshold)
+    {
+        if (StorageMode == ComponentStorageMode::Archetype)
+        {
+            return false;
+        }
+
+        GetOrCreateComponentArray<T>()->SetCompactionThreshold(threshold);
+        return true;
     }
 
     // 移除特定组件的组件数组
     template <typename T>
-        requires std::is_base_of_v<Component<T>, T>
+        requires ComponentType<T>
     void RemoveComponentArray()
     {
-        auto compTypeIndex = std::type_index(typeid(T));
+        if (StorageMode == ComponentStorageMode::Archetype)
+        {
+            Archetypes.RemoveComponentFromAll<T>();
+            return;
+        }
+
+        const auto TYPE_ID = GetComponentTypeID<T>();
+
+        if (TYPE_ID < ComponentArrays.size())
+        {
+            // 先销毁拥有该容器的组
+            if (ComponentArrays[TYPE_ID].IsValid())
+            {
+                DestroyGroup(ComponentArrays[TYPE_ID]->GetOwnerGroup());
+            }
+
+            ComponentArrays[TYPE_ID] = ComponentArrayHandle();
+        }
+    }
+
+    /**
+     * 获取拥有Ts...的组，不存在则创建(仅SparseSet模式)
+     *
+     * 组会接管Ts...的组件容器，使同时拥有Ts...的实体紧凑地排列在每个容器的前部。
+     * 每个组件容器只能被一个组拥有，若某个容器已被其他组拥有，或处于Archetype模式，则返回nullptr。
+     * 已存在以其他顺序声明相同组件的组时同样返回nullptr。
+     * 组按连续内存访问组件，因此不能包含稳定地址存储的组件。
+     */
+    template <typename... Ts>
+        requires(sizeof...(Ts) > 1) && (ComponentType<Ts> && ...) && TUniqueTypes<Ts...>::value
+                && (!StableComponentType<Ts> && ...)
+    ComponentGroup<Ts...>* GetOrCreateGroup()
+    {
+        if (StorageMode == ComponentStorageMode::Archetype)
+        {
+            return nullptr;
+        }
+
+        auto typeIDs = ComponentGroup<Ts...>::GetTypeIDs();
 
-        if (ComponentArrays.contains(compTypeIndex))
+        for (const auto& entry : Groups)
         {
-            ComponentArrays.erase(compTypeIndex);
+            if (entry.TypeIDs == typeIDs)
+            {
+                // 相同组件集合的不同排列是不同的实例化，不能互相转换，只有完全相同的类型才返回已有的组
+                if (entry.GroupType != std::type_index(typeid(ComponentGroup<Ts...>)))
+                {
+                    return nullptr;
+                }
+
+                return static_cast<ComponentGroup<Ts...>*>(entry.Group.get());
+            }
+        }
+
+        auto arrays = std::make_tuple(GetOrCreateComponentArray<Ts>()...);
+
+        const bool OWNED =
+            std::apply([](const auto*... compArrays) { return ((compArrays->GetOwnerGroup() != nullptr) || ...); },
+                       arrays);
+
+        if (OWNED)
+        {
+            return nullptr;
         }
+
+        auto  group = std::make_unique<ComponentGroup<Ts...>>(std::get<ComponentArray<Ts>*>(arrays)...);
+        auto* groupPtr = group.get();
+
+        Groups.push_back(GroupEntry{.TypeIDs = std::move(typeIDs),
+                                    .GroupType = std::type_index(typeid(ComponentGroup<Ts...>)),
+                                    .Group = std::move(group)});
+
+        return groupPtr;
     }
 
-    // 获取特定组件类型的组件数组
+    // 获取特定组件类型的组件数组，不存在则返回nullptr。Archetype模式下始终返回nullptr。返回可变指针，因此视为修改
     template <typename T>
-        requires std::is_base_of_v<Component<T>, T>
+        requires ComponentType<T>
     ComponentArray<T>* GetComponentArray()
     {
-        auto compTypeIndex = std::type_index(typeid(T));
+        auto* compArray = const_cast<ComponentArray<T>*>(FindComponentArray<T>());
 
-        if (!ComponentArrays.contains(compTypeIndex))
+        if (compArray != nullptr)
         {
-            return nullptr;
+            compArray->MarkModified();
         }
 
-        return ComponentArrays[compTypeIndex].As<T>();
+        return compArray;
+    }
+
+    // 只读获取特定组件类型的组件数组，不存在则返回nullptr。不会标记修改
+    template <typename T>
+        requires ComponentType<T>
+    [[nodiscard]] const ComponentArray<T>* FindComponentArray() const
+    {
+        const auto TYPE_ID = GetComponentTypeID<T>();
+
+        // 组件类型ID是稠密的，直接以ID作为下标访问
+        return TYPE_ID < ComponentArrays.size() ? ComponentArrays[TYPE_ID].template As<T>() : nullptr;
     }
 
     // 移除Entity的所有组件
     void RemoveEntityAllComponents(EntityIndexType entityIndex);
 
+    // 批量移除多个Entity的所有组件，按组件类型逐个处理以保持缓存局部性
+    void RemoveEntitiesAllComponents(std::span<const EntityIndexType> entityIndices);
+
     // 回调访问特定类型的所有组件
     template <typename T>
-        requires std::is_base_of_v<Component<T>, T>
+        requires ComponentType<T>
     void ForEachComponent(const std::function<void(T&)>& callback)
     {
-        auto compType = std::type_index(typeid(T));
+        if (StorageMode == ComponentStorageMode::Archetype)
+        {
+            Archetypes.ForEachComponent<T>(callback);
+            return;
+        }
 
-        if (!ComponentArrays.contains(compType))
+        if (auto* compArray = GetComponentArray<T>())
         {
+            compArray->ForEachComponent(callback);
+        }
+    }
+
+    // 并行回调访问特定类型的所有组件，func的签名为void(T&)或bool(T&)，返回true的组件会被标记为已修改。pool为空时按顺序执行
+    template <typename T, typename Func>
+        requires ComponentType<T>
+    void ParallelForEach(ThreadPool* pool, Func&& func, size_t grainSize = 0)
+    {
+        if (StorageMode == ComponentStorageMode::Archetype)
+        {
+            Archetypes.ParallelForEachComponent<T>(pool, std::forward<Func>(func), grainSize);
             return;
         }
 
-        auto* compArray = ComponentArrays[compType].As<T>();
+        if (auto* compArray = GetComponentArray<T>())
+        {
+            compArray->ParallelForEach(pool, std::forward<Func>(func), grainSize);
+        }
+    }
 
-        compArray->ForEachComponent(callback);
+    // 并行归约特定类型的所有组件，partial按固定顺序合并，结果与线程数量无关
+    template <typename T, typename TResult, typename MapFunc, typename ReduceFunc>
+        requires ComponentType<T>
+    TResult ParallelReduce(ThreadPool* pool, TResult identity, MapFunc&& map, ReduceFunc&& reduce, size_t grainSize = 0)
+    {
+        if (StorageMode == ComponentStorageMode::Archetype)
+        {
+            return Archetypes.ParallelReduceComponent<T>(pool, std::move(identity), std::forward<MapFunc>(map),
+                                                         std::forward<ReduceFunc>(reduce), grainSize);
+        }
+
+        auto* compArray = GetComponentArray<T>();
+
+        if (compArray == nullptr)
+        {
+            return identity;
+        }
+
+        return compArray->ParallelReduce(pool, std::move(identity), std::forward<MapFunc>(map),
+                                         std::forward<ReduceFunc>(reduce), grainSize);
     }
 
 private:
-    ComponentManager() = default;
+    explicit ComponentManager(std::pmr::memory_resource* resource) : ComponentArrays(resource)
+    {}
+
     ~ComponentManager() = default;
 
     ComponentManager(const ComponentManager&) = delete;
@@ -145,7 +449,58 @@ private:
     ComponentManager& operator=(const ComponentManager&) = delete;
     ComponentManager& operator=(ComponentManager&&) noexcept = delete;
 
-    // 每种组件类型对应的组件数组
-    std::unordered_map<std::type_index, ComponentArrayHandle> ComponentArrays;
+    // 组件存储后端
+    ComponentStorageMode StorageMode = ComponentStorageMode::SparseSet;
+
+    // 当前Tick，变化追踪以它为时间戳
+    ComponentTick CurrentTick = 1;
+
+    // 所属World的实体管理器，用于在移除日志中记录完整实体，由World设置
+    const EntityManager* EntitySource = nullptr;
+
+    // 获取特定组件类型的组件数组，不存在则创建
+    template <typename T>
+        requires ComponentType<T>
+    ComponentArray<T>* GetOrCreateComponentArray()
+    {
+        const auto TYPE_ID = GetComponentTypeID<T>();
+
+        if (TYPE_ID >= ComponentArrays.size())
+        {
+            ComponentArrays.resize(static_cast<size_t>(TYPE_ID) + 1);
+        }
+
+        if (!ComponentArrays[TYPE_ID].IsValid())
+        {
+            ComponentArrays[TYPE_ID] = MakeComponentArrayHandle<T>(ComponentArrays.get_allocator().resource());
+        }
+
+        return ComponentArrays[TYPE_ID].template As<T>();
+    }
+
+    /**
+     * 每种组件类型对应的组件数组(SparseSet模式)。ComponentTypeID -> ComponentArray，未使用的位置为空Handle
+     * 映射表、组件容器及其存储都从World的memory_resource分配
+     */
+    std::pmr::vector<ComponentArrayHandle> ComponentArrays;
+
+    // 原型存储(Archetype模式)
+    ArchetypeStorage Archetypes;
+
+    struct GroupEntry final
+    {
+        std::vector<ComponentTypeID> TypeIDs;
+
+        // 创建组时使用的ComponentGroup<Ts...>实例化
+        std::type_index GroupType;
+
+        std::unique_ptr<IComponentGroupBase> Group;
+    };
+
+    // 销毁某个组，被它拥有的组件容器恢复为普通容器
+    void DestroyGroup(const IComponentGroupBase* group);
+
+    // 所有拥有型组，声明在ComponentArrays之后，因此先于组件容器析构
+    std::vector<GroupEntry> Groups;
 };
 } // namespace NekiraECS
\ No newline at end of file
@@ -0,0 +1,136 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <NekiraECS/Core/Component/Component.hpp>
+#include <NekiraECS/Core/Entity/Entity.hpp>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+
+namespace NekiraECS
+{
+
+/**
+ * 组件生命周期事件
+ * - Construct: 组件被添加到实体上
+ * - Replace: 实体已有的组件被新值替换
+ * - Destroy: 组件即将被移除(包括销毁实体与清空容器)
+ */
+enum class ComponentEventType : uint8_t
+{
+    Construct = 0,
+    Replace,
+    Destroy
+};
+
+// 组件生命周期事件记录
+struct ComponentEvent final
+{
+    Entity             Target;
+    ComponentEventType Type;
+};
+
+// 观察者ID，用于取消订阅
+using ComponentObserverID = uint32_t;
+
+// 无效的观察者ID
+constexpr ComponentObserverID INVALID_COMPONENT_OBSERVER_ID = 0;
+
+/**
+ * 某个组件类型的观察者列表
+ *
+ * @[INFO] 两种分发方式：
+ *
+ * 1.Immediate: 事件发生时立即回调，回调可以访问组件本身。Destroy在组件移除之前回调，此时组件依然有效。
+ * 2.Batched: 事件被追加到一个连续的缓冲中，Flush()时每个监听者只回调一次，一次性拿到这段时间内的所有事件，
+ *   不存在逐事件的间接调用。SystemManager在每个系统分组结束后Flush。
+ *
+ * @[NOTE] Immediate回调中不可增删同类型的组件(会破坏正在进行的增删)，需要时使用CommandBuffer，
+ *         记录的命令在下一个同步点执行(回调发生在回放期间时也是如此)。
+ *         在回调中订阅或取消订阅同类型的观察者也是不允许的
+ */
+class ComponentObservers final
+{
+public:
+    // 立即回调，component指向该组件
+    using ImmediateListener = std::function<void(const Entity&, ComponentEventType, void*)>;
+
+    // 批量回调，events在回调期间有效
+    using BatchedListener = std::function<void(std::span<const ComponentEvent>)>;
+
+    // entityManager用于把实体索引还原为完整实体，可以为空
+    explicit ComponentObservers(const EntityManager* entityManager);
+
+    // 订阅立即回调
+    ComponentObserverID AddImmediate(ImmediateListener listener);
+
+    // 订阅批量回调
+    ComponentObserverID AddBatched(BatchedListener listener);
+
+    // 取消订阅，成功返回true
+    bool Remove(ComponentObserverID id);
+
+    // 是否没有任何观察者
+    [[nodiscard]] bool IsEmpty() const;
+
+    // 通知一次事件
+    void Notify(EntityIndexType entityIndex, ComponentEventType type, void* component)
+    {
+        if (ImmediateEntries.empty() && BatchedEntries.empty())
+        {
+            return;
+        }
+
+        const Entity TARGET = Entities != nullptr ? Entities->GetEntity(entityIndex) : Entity();
+
+        for (const auto& entry : ImmediateEntries)
+        {
+            entry.Listener(TARGET, type, component);
+        }
+
+        if (!BatchedEntries.empty())
+        {
+            Events.push_back(ComponentEvent{.Target = TARGET, .Type = type});
+        }
+    }
+
+    // 把缓冲中的事件分发给所有批量监听者。监听者在回调中引发的新事件会在下一次Flush时分发
+    void Flush();
+
+private:
+    struct ImmediateEntry final
+    {
+        ComponentObserverID ID;
+        ImmediateListener   Listener;
+    };
+
+    struct BatchedEntry final
+    {
+        ComponentObserverID ID;
+        BatchedListener     Listener;
+    };
+
+    const EntityManager* Entities = nullptr;
+
+    std::vector<ImmediateEntry> ImmediateEntries;
+    std::vector<BatchedEntry>   BatchedEntries;
+
+    // 等待分发的事件
+    std::vector<ComponentEvent> Events;
+
+    // 正在分发的事件，与Events交换以复用容量
+    std::vector<ComponentEvent> FlushingEvents;
+
+    ComponentObserverID NextID = INVALID_COMPONENT_OBSERVER_ID + 1;
+};
+
+} // namespace NekiraECS
@@ -0,0 +1,236 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <NekiraECS/Core/Component/Component.hpp>
+#include <NekiraECS/Core/Entity/Entity.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+
+namespace NekiraECS
+{
+
+// 组件变化的类型
+enum class ComponentChangeKind : uint8_t
+{
+    Added = 0,
+    Changed
+};
+
+// 变化查询过滤器：只匹配自sinceTick(含)起新添加的T
+template <typename T>
+    requires ComponentType<T>
+struct Added final
+{
+    using Type = T;
+
+    static constexpr ComponentChangeKind KIND = ComponentChangeKind::Added;
+};
+
+// 变化查询过滤器：匹配自sinceTick(含)起添加或修改过的T
+template <typename T>
+    requires ComponentType<T>
+struct Changed final
+{
+    using Type = T;
+
+    static constexpr ComponentChangeKind KIND = ComponentChangeKind::Changed;
+};
+
+// 变化查询过滤器约束
+template <typename TFilter>
+concept ChangeFilterType =
+    requires { typename TFilter::Type; }
+    && (std::is_same_v<TFilter, Added<typename TFilter::Type>>
+        || std::is_same_v<TFilter, Changed<typename TFilter::Type>>);
+
+
+/**
+ * 组件变化追踪：为组件容器的每个位置记录添加与修改的Tick，并记录变化日志与移除日志
+ *
+ * @[INFO] 追踪逻辑：
+ *
+ * 1.添加Tick与修改Tick与组件容器的紧凑集合一一对应，随swap-and-pop、交换与排序同步调整。
+ * 2.每次添加都会向Added与Changed日志追加一条(实体索引, Tick)记录；修改只在该组件本Tick内第一次被修改时追加记录，
+ *   因此日志长度与变化数量成正比，查询"自某个Tick以来的变化"时只需二分定位再遍历日志的尾部，而不是遍历所有组件。
+ * 3.日志记录可能已过期(组件之后又被修改、已被移除或被重新添加)。每个位置还记录了它最新一条日志的序号，
+ *   查询时只报告最新的记录，因此每个组件只会被报告一次。
+ * 4.日志在同步点(Tick递增时)裁剪：超过容器大小的两倍时丢弃较旧的一半，并提高LogFloor。
+ *   早于LogFloor的查询会退化为对Tick数组的全量扫描，结果依然正确。
+ *
+ * @[NOTE] 移除日志同样会被裁剪，早于裁剪点的移除记录会丢失，消费者应当每帧(或至少定期)读取移除日志
+ */
+class ComponentTracker final
+{
+public:
+    // 变化日志记录
+    struct TickRecord final
+    {
+        EntityIndexType EntityIndex;
+        ComponentTick   Tick;
+    };
+
+    // 移除日志记录，记录移除时的完整实体，即使实体已被销毁，消费者也能据此识别它
+    struct RemovedRecord final
+    {
+        Entity        Target;
+        ComponentTick Tick;
+    };
+
+    // currentTick指向所属ComponentManager的当前Tick，entityManager用于在移除时记录完整实体，可以为空
+    ComponentTracker(const ComponentTick* currentTick, const EntityManager* entityManager, size_t size);
+
+    // 新组件已追加到紧凑集合末尾
+    void OnAdded(EntityIndexType entityIndex)
+    {
+        const ComponentTick TICK = *CurrentTick;
+
+        for (size_t kind = 0; kind < KIND_COUNT; ++kind)
+        {
+            Ticks[kind].push_back(TICK);
+            Sequences[kind].push_back(NextSequence(kind));
+            Logs[kind].push_back(TickRecord{.EntityIndex = entityIndex, .Tick = TICK});
+        }
+    }
+
+    // 紧凑集合中denseIndex上的组件被修改
+    void OnChanged(size_t denseIndex, EntityIndexType entityIndex)
+    {
+        const ComponentTick TICK = *CurrentTick;
+
+        auto& changedTicks = Ticks[CHANGED];
+
+        // 本Tick内已记录过
+        if (changedTicks[denseIndex] == TICK)
+        {
+            return;
+        }
+
+        changedTicks[denseIndex] = TICK;
+        Sequences[CHANGED][denseIndex] = NextSequence(CHANGED);
+        Logs[CHANGED].push_back(TickRecord{.EntityIndex = entityIndex, .Tick = TICK});
+    }
+
+    // 紧凑集合中denseIndex上的组件被移除，与组件容器相同地用末尾元素覆盖它
+    void OnRemoved(size_t denseIndex, EntityIndexType entityIndex)
+    {
+        for (size_t kind = 0; kind < KIND_COUNT; ++kind)
+        {
+            Ticks[kind][denseIndex] = Ticks[kind].back();
+            Ticks[kind].pop_back();
+
+            Sequences[kind][denseIndex] = Sequences[kind].back();
+            Sequences[kind].pop_back();
+        }
+
+        RecordRemoved(entityIndex);
+    }
+
+    // 组件容器已被清空，entityIndices为清空前的紧凑集合
+    void OnCleared(std::span<const EntityIndexType> entityIndices);
+
+    // 交换紧凑集合中两个位置的Tick
+    void Swap(size_t lhs, size_t rhs)
+    {
+        for (size_t kind = 0; kind < KIND_COUNT; ++kind)
+        {
+            std::swap(Ticks[kind][lhs], Ticks[kind][rhs]);
+            std::swap(Sequences[kind][lhs], Sequences[kind][rhs]);
+        }
+    }
+
+    // 在同步点调用，size为组件容器的当前大小
+    void Trim(size_t size);
+
+    // Tick数组与各日志已分配的字节数
+    [[nodiscard]] size_t GetMemoryBytes() const;
+
+    // 紧凑集合中每个位置的Tick
+    [[nodiscard]] const std::vector<ComponentTick>& GetTicks(ComponentChangeKind kind) const
+    {
+        return Ticks[static_cast<size_t>(kind)];
+    }
+
+    // 变化日志，按Tick升序
+    [[nodiscard]] const std::vector<TickRecord>& GetLog(ComponentChangeKind kind) const
+    {
+        return Logs[static_cast<size_t>(kind)];
+    }
+
+    // 日志中position处的记录是否是紧凑集合中denseIndex位置的最新记录
+    [[nodiscard]] bool IsLatestRecord(ComponentChangeKind kind, size_t position, size_t denseIndex) const
+    {
+        const auto KIND = static_cast<size_t>(kind);
+
+        return Sequences[KIND][denseIndex] == static_cast<uint32_t>(LogBases[KIND] + position);
+    }
+
+    // 日志完整覆盖的最早Tick，早于它的查询需要全量扫描
+    [[nodiscard]] ComponentTick GetLogFloor(ComponentChangeKind kind) const
+    {
+        return LogFloors[static_cast<size_t>(kind)];
+    }
+
+    // 回调访问自sinceTick(含)以来被移除的实体，func的签名为void(const Entity&)
+    template <typename Func>
+    void ForEachRemoved(ComponentTick sinceTick, Func&& func) const
+    {
+        auto it = std::ranges::lower_bound(Removed, sinceTick, {}, &RemovedRecord::Tick);
+
+        for (; it != Removed.end(); ++it)
+        {
+            func(it->Target);
+        }
+    }
+
+    // 日志的最小保留长度
+    static constexpr size_t MIN_LOG_CAPACITY = 64;
+
+private:
+    static constexpr size_t CHANGED = static_cast<size_t>(ComponentChangeKind::Changed);
+    static constexpr size_t KIND_COUNT = 2;
+
+    // 记录一次移除
+    void RecordRemoved(EntityIndexType entityIndex);
+
+    // 即将追加的日志记录的序号
+    [[nodiscard]] uint32_t NextSequence(size_t kind) const
+    {
+        return static_cast<uint32_t>(LogBases[kind] + Logs[kind].size());
+    }
+
+    const ComponentTick* CurrentTick = nullptr;
+
+    const EntityManager* Entities = nullptr;
+
+    // 紧凑集合中每个位置的添加Tick与修改Tick
+    std::array<std::vector<ComponentTick>, KIND_COUNT> Ticks;
+
+    // 紧凑集合中每个位置最新一条日志记录的序号，序号 = 已裁剪的记录数量 + 记录在日志中的位置(按2^32回绕)
+    std::array<std::vector<uint32_t>, KIND_COUNT> Sequences;
+
+    // 添加日志与修改日志
+    std::array<std::vector<TickRecord>, KIND_COUNT> Logs;
+
+    // 每种日志已裁剪的记录数量(按2^32回绕)
+    std::array<uint32_t, KIND_COUNT> LogBases{};
+
+    // 日志完整覆盖的最早Tick
+    std::array<ComponentTick, KIND_COUNT> LogFloors{};
+
+    // 移除日志，按Tick升序
+    std::vector<RemovedRecord> Removed;
+};
+
+} // namespace NekiraECS
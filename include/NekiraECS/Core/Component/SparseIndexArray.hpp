@@ -0,0 +1,233 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <NekiraECS/Core/Primary/PrimaryType.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+
+namespace NekiraECS
+{
+
+/**
+ * 分页的稀疏索引数组：EntityIndex -> ComponentIndex
+ *
+ * @[INFO] 存储逻辑：
+ *
+ * 1.实体索引按PAGE_SIZE划分为若干页，只有当某页中至少有一个实体拥有该组件时才分配该页。
+ * 2.每页记录有效元素的数量，当该页不再有有效元素时立即释放。
+ * 3.值的宽度与EntityIndexType一致(组件数量不会超过实体数量)，无效值为INVALID_ENTITY_INDEX。
+ *
+ * 因此稀有组件只占用少量的页，高索引实体首次获得组件时也只需分配一页，而不是把整个数组扩容到该索引。
+ * 页与页表都从构造时传入的memory_resource分配。
+ */
+class SparseIndexArray final
+{
+public:
+    // 每页的元素数量
+    static constexpr size_t PAGE_SIZE = 1024;
+
+    // 无效值
+    static constexpr EntityIndexType INVALID_VALUE = INVALID_ENTITY_INDEX;
+
+    explicit SparseIndexArray(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : Pages(resource)
+    {}
+
+    SparseIndexArray(const SparseIndexArray&) = delete;
+    SparseIndexArray(SparseIndexArray&&) noexcept = delete;
+    SparseIndexArray& operator=(const SparseIndexArray&) = delete;
+    SparseIndexArray& operator=(SparseIndexArray&&) noexcept = delete;
+
+    ~SparseIndexArray()
+    {
+        Clear();
+    }
+
+    // 获取entityIndex对应的值，不存在则返回INVALID_VALUE
+    [[nodiscard]] EntityIndexType Get(EntityIndexType entityIndex) const
+    {
+        const size_t PAGE = entityIndex / PAGE_SIZE;
+
+        if (PAGE >= Pages.size() || Pages[PAGE] == nullptr)
+        {
+            return INVALID_VALUE;
+        }
+
+        return Pages[PAGE]->Values[entityIndex % PAGE_SIZE];
+    }
+
+    // 是否存在entityIndex对应的值
+    [[nodiscard]] bool Contains(EntityIndexType entityIndex) const
+    {
+        return Get(entityIndex) != INVALID_VALUE;
+    }
+
+    // 获取entityIndex对应的值，调用者需保证该值存在
+    [[nodiscard]] EntityIndexType GetUnchecked(EntityIndexType entityIndex) const
+    {
+        return Pages[entityIndex / PAGE_SIZE]->Values[entityIndex % PAGE_SIZE];
+    }
+
+    // 设置entityIndex对应的值，按需分配页
+    void Set(EntityIndexType entityIndex, EntityIndexType value)
+    {
+        const size_t PAGE = entityIndex / PAGE_SIZE;
+
+        if (PAGE >= Pages.size())
+        {
+            Pages.resize(PAGE + 1);
+        }
+
+        if (Pages[PAGE] == nullptr)
+        {
+            Pages[PAGE] = GetAllocator().new_object<Page>();
+            ++PageCount;
+        }
+
+        auto& slot = Pages[PAGE]->Values[entityIndex % PAGE_SIZE];
+
+        if (slot == INVALID_VALUE)
+        {
+            ++Pages[PAGE]->Count;
+        }
+
+        slot = value;
+    }
+
+    // 移除entityIndex对应的值，页为空时释放该页
+    void Remove(EntityIndexType entityIndex)
+    {
+        const size_t PAGE = entityIndex / PAGE_SIZE;
+
+        if (PAGE >= Pages.size() || Pages[PAGE] == nullptr)
+        {
+            return;
+        }
+
+        auto& slot = Pages[PAGE]->Values[entityIndex % PAGE_SIZE];
+
+        if (slot == INVALID_VALUE)
+        {
+            return;
+        }
+
+        slot = INVALID_VALUE;
+
+        if (--Pages[PAGE]->Count == 0)
+        {
+            ReleasePage(Pages[PAGE]);
+
+            // 收缩末尾的空页指针
+            while (!Pages.empty() && Pages.back() == nullptr)
+            {
+                Pages.pop_back();
+            }
+        }
+    }
+
+    /**
+     * 重置为entityIndices[i] -> i的映射，调用者需保证实体索引互不重复
+     *
+     * 已分配的页会被复用(整页填充为无效值)，而不是释放后重新分配，最后释放仍为空的页。
+     */
+    void Assign(std::span<const EntityIndexType> entityIndices)
+    {
+        for (auto& page : Pages)
+        {
+            if (page != nullptr)
+            {
+                page->Values.fill(INVALID_VALUE);
+                page->Count = 0;
+            }
+        }
+
+        for (size_t index = 0; index < entityIndices.size(); ++index)
+        {
+            Set(entityIndices[index], static_cast<EntityIndexType>(index));
+        }
+
+        for (auto& page : Pages)
+        {
+            if (page != nullptr && page->Count == 0)
+            {
+                ReleasePage(page);
+            }
+        }
+
+        while (!Pages.empty() && Pages.back() == nullptr)
+        {
+            Pages.pop_back();
+        }
+    }
+
+    // 清空
+    void Clear()
+    {
+        for (auto& page : Pages)
+        {
+            if (page != nullptr)
+            {
+                ReleasePage(page);
+            }
+        }
+
+        Pages.clear();
+    }
+
+    // 已分配的页数量
+    [[nodiscard]] size_t GetPageCount() const
+    {
+        return PageCount;
+    }
+
+    // 已分配的页与页表的字节数
+    [[nodiscard]] size_t GetMemoryBytes() const
+    {
+        return PageCount * sizeof(Page) + Pages.capacity() * sizeof(Page*);
+    }
+
+private:
+    struct Page final
+    {
+        Page()
+        {
+            Values.fill(INVALID_VALUE);
+        }
+
+        std::array<EntityIndexType, PAGE_SIZE> Values;
+
+        // 该页中有效值的数量
+        size_t Count = 0;
+    };
+
+    std::pmr::polymorphic_allocator<Page> GetAllocator() const
+    {
+        return Pages.get_allocator();
+    }
+
+    // 释放页并置空页表中的指针
+    void ReleasePage(Page*& page)
+    {
+        GetAllocator().delete_object(page);
+        page = nullptr;
+        --PageCount;
+    }
+
+    std::pmr::vector<Page*> Pages;
+
+    size_t PageCount = 0;
+};
+
+} // namespace NekiraECS
@@ -0,0 +1,499 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <NekiraECS/Core/Component/TagComponentStorage.hpp>
+#include <NekiraECS/Core/Primary/PrimaryType.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace NekiraECS
+{
+
+/**
+ * 为组件类型开启稳定地址存储：
+ * template <> struct NekiraECS::TStableComponent<Rigidbody> : std::true_type {};
+ *
+ * 需在首次使用该组件类型之前特化。标签组件不占用存储，因此不能开启。
+ */
+template <typename T>
+struct TStableComponent : std::false_type
+{};
+
+// 开启了稳定地址存储的组件类型
+template <typename T>
+concept StableComponentType = ComponentType<T> && !TagComponentType<T> && TStableComponent<T>::value;
+
+
+/**
+ * 稳定地址的分页组件存储，提供ComponentArray用到的std::vector<T>接口子集
+ *
+ * @[INFO] 存储逻辑：
+ *
+ * 1.组件存放在固定大小的页中，页一经分配就不会移动，因此添加组件不会使其他组件的地址失效。
+ * 2.紧凑下标通过Slots映射到槽位。交换与swap-and-pop只作用于Slots，组件本身不移动，
+ *   被移除组件的槽位进入空闲列表(墓碑)，之后添加的组件优先复用它。
+ * 3.只有Compact()会移动组件：按紧凑下标的顺序重新排列到新页中，释放所有空洞，并递增地址世代(AddressEpoch)。
+ *   复制、移动赋值(回滚恢复、快照加载)同样会重新排列组件并递增世代。
+ *
+ * 因此在两次世代变化之间，组件的地址只会因移除该组件而失效，可以跨帧缓存。
+ *
+ * @[NOTE] 没有data()，不能被组拥有，也不能按连续内存整段访问
+ */
+template <typename T>
+    requires StableComponentType<T>
+class StableComponentStorage final
+{
+public:
+    // 每页的组件数量：约16KB，向下取整为2的幂
+    static constexpr size_t PAGE_SIZE = std::bit_floor(std::max<size_t>(1, 16384 / sizeof(T)));
+
+    // 默认的压缩阈值，见SetCompactionThreshold
+    static constexpr double DEFAULT_COMPACTION_THRESHOLD = 0.5;
+
+    template <bool IS_CONST>
+    class TIterator final
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = T;
+        using pointer = std::conditional_t<IS_CONST, const T*, T*>;
+        using reference = std::conditional_t<IS_CONST, const T&, T&>;
+
+        using StorageType = std::conditional_t<IS_CONST, const StableComponentStorage, StableComponentStorage>;
+
+        TIterator() = default;
+
+        TIterator(StorageType* storage, size_t position) : Storage(storage), Position(position)
+        {}
+
+        reference operator*() const
+        {
+            return (*Storage)[Position];
+        }
+
+        TIterator& operator++()
+        {
+            ++Position;
+            return *this;
+        }
+
+        TIterator operator++(int)
+        {
+            TIterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        bool operator==(const TIterator& other) const
+        {
+            return Position == other.Position;
+        }
+
+    private:
+        StorageType* Storage = nullptr;
+
+        size_t Position = 0;
+    };
+
+    using Iterator = TIterator<false>;
+    using ConstIterator = TIterator<true>;
+
+    explicit StableComponentStorage(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : Pages(resource), Slots(resource), FreeSlots(resource)
+    {}
+
+    // 与std::pmr容器一致，复制构造使用默认的memory_resource
+    StableComponentStorage(const StableComponentStorage& other) : CompactionThreshold(other.CompactionThreshold)
+    {
+        insert(end(), other.begin(), other.end());
+    }
+
+    StableComponentStorage(StableComponentStorage&& other) noexcept
+        : Pages(std::move(other.Pages)), Slots(std::move(other.Slots)), FreeSlots(std::move(other.FreeSlots)),
+          SlotCount(std::exchange(other.SlotCount, 0)), AddressEpoch(other.AddressEpoch),
+          CompactionThreshold(other.CompactionThreshold)
+    {}
+
+    // 按other的紧凑顺序逐个复制，保留自身的memory_resource与压缩阈值
+    StableComponentStorage& operator=(const StableComponentStorage& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            insert(end(), other.begin(), other.end());
+            ++AddressEpoch;
+        }
+
+        return *this;
+    }
+
+    // memory_resource相同时直接接管other的页，否则逐个移动
+    StableComponentStorage& operator=(StableComponentStorage&& other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        const uint64_t EPOCH = std::max(AddressEpoch, other.AddressEpoch) + 1;
+
+        if (GetResource() == other.GetResource())
+        {
+            ReleaseAll();
+
+            Pages = std::move(other.Pages);
+            Slots = std::move(other.Slots);
+            FreeSlots = std::move(other.FreeSlots);
+            SlotCount = std::exchange(other.SlotCount, 0);
+
+            other.Pages.clear();
+            other.Slots.clear();
+            other.FreeSlots.clear();
+        }
+        else
+        {
+            clear();
+
+            for (auto& component : other)
+            {
+                emplace_back(std::move(component));
+            }
+
+            other.clear();
+        }
+
+        AddressEpoch = EPOCH;
+
+        return *this;
+    }
+
+    ~StableComponentStorage()
+    {
+        ReleaseAll();
+    }
+
+    [[nodiscard]] size_t size() const
+    {
+        return Slots.size();
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return Slots.empty();
+    }
+
+    // 已分配的槽位数量，包括空闲槽位
+    [[nodiscard]] size_t capacity() const
+    {
+        return Pages.size() * PAGE_SIZE;
+    }
+
+    // 分配页，使槽位总数不少于count
+    void reserve(size_t count)
+    {
+        Slots.reserve(count);
+
+        while (capacity() < count)
+        {
+            AllocatePage();
+        }
+    }
+
+    // 销毁所有组件，保留已分配的页
+    void clear()
+    {
+        for (const auto SLOT : Slots)
+        {
+            std::destroy_at(GetAddress(SLOT));
+        }
+
+        Slots.clear();
+        FreeSlots.clear();
+        SlotCount = 0;
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        const EntityIndexType SLOT = AcquireSlot();
+
+        // 先记录槽位，构造失败时再归还，保证Slots中的槽位都存放着组件
+        Slots.push_back(SLOT);
+
+        try
+        {
+            return *std::construct_at(GetAddress(SLOT), std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            Slots.pop_back();
+            FreeSlots.push_back(SLOT);
+            throw;
+        }
+    }
+
+    void push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+
+    // 销毁末尾的组件，其槽位进入空闲列表
+    void pop_back()
+    {
+        const EntityIndexType SLOT = Slots.back();
+
+        std::destroy_at(GetAddress(SLOT));
+
+        Slots.pop_back();
+        FreeSlots.push_back(SLOT);
+    }
+
+    // 只支持在末尾插入
+    template <typename TPosition, typename InputIt>
+    void insert(TPosition /*position*/, InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+        {
+            emplace_back(*first);
+        }
+    }
+
+    template <typename InputIt>
+    void assign(InputIt first, InputIt last)
+    {
+        clear();
+        insert(end(), first, last);
+    }
+
+    T& operator[](size_t index)
+    {
+        return *GetAddress(Slots[index]);
+    }
+
+    const T& operator[](size_t index) const
+    {
+        return *GetAddress(Slots[index]);
+    }
+
+    [[nodiscard]] Iterator begin()
+    {
+        return Iterator(this, 0);
+    }
+
+    [[nodiscard]] Iterator end()
+    {
+        return Iterator(this, size());
+    }
+
+    [[nodiscard]] ConstIterator begin() const
+    {
+        return ConstIterator(this, 0);
+    }
+
+    [[nodiscard]] ConstIterator end() const
+    {
+        return ConstIterator(this, size());
+    }
+
+    // 交换两个紧凑下标对应的槽位，组件本身不移动
+    void SwapDense(size_t lhs, size_t rhs)
+    {
+        std::swap(Slots[lhs], Slots[rhs]);
+    }
+
+    // 空闲槽位占已使用槽位的比例
+    [[nodiscard]] double GetFragmentation() const
+    {
+        return SlotCount > 0 ? static_cast<double>(FreeSlots.size()) / static_cast<double>(SlotCount) : 0.0;
+    }
+
+    /**
+     * 设置自动压缩的阈值，空闲槽位的比例超过它且至少有一页空闲槽位时，在同步点(Tick递增时)自动压缩
+     *
+     * 不小于1时不会自动压缩，只在调用Compact()时压缩。
+     */
+    void SetCompactionThreshold(double threshold)
+    {
+        CompactionThreshold = threshold;
+    }
+
+    [[nodiscard]] double GetCompactionThreshold() const
+    {
+        return CompactionThreshold;
+    }
+
+    // 是否达到自动压缩的条件
+    [[nodiscard]] bool ShouldCompact() const
+    {
+        return FreeSlots.size() >= PAGE_SIZE && GetFragmentation() > CompactionThreshold;
+    }
+
+    /**
+     * 压缩：把组件按紧凑下标的顺序移动到新页中，之后槽位与紧凑下标一致，没有任何空洞
+     *
+     * 旧页全部释放，地址世代递增。已经紧凑且有序时不做任何事。
+     */
+    void Compact()
+    {
+        const size_t COUNT = Slots.size();
+
+        if (FreeSlots.empty() && SlotCount == COUNT && IsOrdered())
+        {
+            return;
+        }
+
+        std::pmr::vector<T*> pages(GetResource());
+
+        auto allocator = GetAllocator();
+
+        while (pages.size() * PAGE_SIZE < COUNT)
+        {
+            pages.push_back(allocator.allocate(PAGE_SIZE));
+        }
+
+        for (size_t index = 0; index < COUNT; ++index)
+        {
+            T* source = GetAddress(Slots[index]);
+
+            std::construct_at(pages[index / PAGE_SIZE] + index % PAGE_SIZE, std::move(*source));
+            std::destroy_at(source);
+        }
+
+        for (T* page : Pages)
+        {
+            allocator.deallocate(page, PAGE_SIZE);
+        }
+
+        Pages = std::move(pages);
+
+        std::iota(Slots.begin(), Slots.end(), EntityIndexType{0});
+        FreeSlots.clear();
+        SlotCount = COUNT;
+
+        ++AddressEpoch;
+    }
+
+    // 地址世代，组件被整体移动(压缩、赋值)时递增，缓存的组件地址应在世代变化后重新获取
+    [[nodiscard]] uint64_t GetAddressEpoch() const
+    {
+        return AddressEpoch;
+    }
+
+    // 槽位表与空闲列表已分配的字节数
+    [[nodiscard]] size_t GetIndexBytes() const
+    {
+        return (Slots.capacity() + FreeSlots.capacity()) * sizeof(EntityIndexType) + Pages.capacity() * sizeof(T*);
+    }
+
+private:
+    [[nodiscard]] std::pmr::memory_resource* GetResource() const
+    {
+        return Pages.get_allocator().resource();
+    }
+
+    [[nodiscard]] std::pmr::polymorphic_allocator<T> GetAllocator() const
+    {
+        return std::pmr::polymorphic_allocator<T>(GetResource());
+    }
+
+    [[nodiscard]] T* GetAddress(size_t slot) const
+    {
+        return Pages[slot / PAGE_SIZE] + slot % PAGE_SIZE;
+    }
+
+    void AllocatePage()
+    {
+        Pages.reserve(Pages.size() + 1);
+        Pages.push_back(GetAllocator().allocate(PAGE_SIZE));
+    }
+
+    // 优先复用最近释放的槽位，否则使用下一个未使用的槽位，按需分配新页
+    EntityIndexType AcquireSlot()
+    {
+        if (!FreeSlots.empty())
+        {
+            const EntityIndexType SLOT = FreeSlots.back();
+            FreeSlots.pop_back();
+            return SLOT;
+        }
+
+        if (SlotCount == capacity())
+        {
+            AllocatePage();
+        }
+
+        return static_cast<EntityIndexType>(SlotCount++);
+    }
+
+    // 槽位是否与紧凑下标一致
+    [[nodiscard]] bool IsOrdered() const
+    {
+        for (size_t index = 0; index < Slots.size(); ++index)
+        {
+            if (Slots[index] != index)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // 销毁所有组件并释放所有页
+    void ReleaseAll()
+    {
+        clear();
+
+        auto allocator = GetAllocator();
+
+        for (T* page : Pages)
+        {
+            allocator.deallocate(page, PAGE_SIZE);
+        }
+
+        Pages.clear();
+    }
+
+    // 每页的起始地址，页不会移动
+    std::pmr::vector<T*> Pages;
+
+    // 紧凑下标 -> 槽位
+    std::pmr::vector<EntityIndexType> Slots;
+
+    // 空闲槽位(墓碑)，后进先出
+    std::pmr::vector<EntityIndexType> FreeSlots;
+
+    // 已使用过的槽位数量，[0, SlotCount)中的槽位要么存放着组件，要么在空闲列表中
+    size_t SlotCount = 0;
+
+    uint64_t AddressEpoch = 0;
+
+    double CompactionThreshold = DEFAULT_COMPACTION_THRESHOLD;
+};
+
+
+template <StableComponentType T>
+struct TComponentStorage<T>
+{
+    using Type = StableComponentStorage<T>;
+};
+
+} // namespace NekiraECS
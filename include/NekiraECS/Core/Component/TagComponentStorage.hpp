@@ -0,0 +1,197 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <NekiraECS/Core/Component/Component.hpp>
+#include <cstddef>
+#include <iterator>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace NekiraECS
+{
+
+/**
+ * 标签组件约束：没有任何数据成员的组件，例如struct IsEnemy {};
+ *
+ * 标签组件只需要记录哪些实体拥有它，ComponentArray会用TagComponentStorage代替std::vector<T>，不为每个组件分配任何存储。
+ */
+template <typename T>
+concept TagComponentType = ComponentType<T> && std::is_empty_v<T> && std::is_default_constructible_v<T>;
+
+
+/**
+ * 标签组件的零存储容器，提供ComponentArray用到的std::vector<T>接口子集
+ *
+ * 容器只记录元素数量，所有元素都引用同一个共享实例。标签组件没有状态，因此对它的赋值、交换都是无操作。
+ *
+ * @[NOTE] data()只指向一个实例，只有下标0有效，按位置访问时应使用operator[]
+ */
+template <typename T>
+    requires TagComponentType<T>
+class TagComponentStorage final
+{
+public:
+    class Iterator final
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = T;
+        using pointer = T*;
+        using reference = T&;
+
+        Iterator() = default;
+
+        explicit Iterator(size_t position) : Position(position)
+        {}
+
+        reference operator*() const
+        {
+            return Instance;
+        }
+
+        Iterator& operator++()
+        {
+            ++Position;
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        bool operator==(const Iterator& other) const
+        {
+            return Position == other.Position;
+        }
+
+    private:
+        size_t Position = 0;
+    };
+
+    TagComponentStorage() = default;
+
+    // 不分配存储，接受memory_resource只是为了与std::pmr::vector的构造方式一致
+    explicit TagComponentStorage(std::pmr::memory_resource* /*resource*/)
+    {}
+
+    [[nodiscard]] size_t size() const
+    {
+        return Count;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return Count == 0;
+    }
+
+    // 不分配存储，容量与数量相同
+    [[nodiscard]] size_t capacity() const
+    {
+        return Count;
+    }
+
+    void reserve(size_t /*capacity*/)
+    {}
+
+    void clear()
+    {
+        Count = 0;
+    }
+
+    void resize(size_t count)
+    {
+        Count = count;
+    }
+
+    void pop_back()
+    {
+        --Count;
+    }
+
+    void push_back(const T& /*value*/)
+    {
+        ++Count;
+    }
+
+    // 构造参数依然会被求值并构造一次，以保持与普通组件一致的语义
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        [[maybe_unused]] T value(std::forward<Args>(args)...);
+
+        ++Count;
+        return Instance;
+    }
+
+    template <typename InputIt>
+    void insert(Iterator /*position*/, InputIt first, InputIt last)
+    {
+        Count += static_cast<size_t>(std::distance(first, last));
+    }
+
+    T& operator[](size_t /*index*/)
+    {
+        return Instance;
+    }
+
+    const T& operator[](size_t /*index*/) const
+    {
+        return Instance;
+    }
+
+    T* data()
+    {
+        return &Instance;
+    }
+
+    const T* data() const
+    {
+        return &Instance;
+    }
+
+    [[nodiscard]] Iterator begin() const
+    {
+        return Iterator(0);
+    }
+
+    [[nodiscard]] Iterator end() const
+    {
+        return Iterator(Count);
+    }
+
+private:
+    size_t Count = 0;
+
+    // 所有元素共享的实例
+    static inline T Instance;
+};
+
+
+// 组件的紧凑存储类型：标签组件使用TagComponentStorage，其余组件使用std::pmr::vector
+template <typename T>
+struct TComponentStorage
+{
+    using Type = std::pmr::vector<T>;
+};
+
+template <TagComponentType T>
+struct TComponentStorage<T>
+{
+    using Type = TagComponentStorage<T>;
+};
+
+} // namespace NekiraECS
@@ -9,21 +9,22 @@
 #pragma once
 
 
-#include <NekiraECS/Core/Component/ComponentManager.hpp>
-#include <NekiraECS/Core/Entity/Entity.hpp>
-#include <NekiraECS/Core/System/SystemManager.hpp>
+#include <NekiraECS/Core/World/World.hpp>
 
 
 
 namespace NekiraECS
 {
 
-// 协调器，负责协调实体、组件和系统
+// 协调器，负责协调实体、组件和系统。所有静态接口都作用于默认World(World::GetDefault())
 class Coordinator final
 {
 public:
     static Coordinator& Get();
 
+    // 获取默认World
+    static World& GetWorld();
+
     // ===============================
     // Entity Management
     // ===============================
@@ -40,6 +41,15 @@ public:
     // 回调访问所有实体
     static void ForEachEntity(const std::function<void(const Entity&)>& callback);
 
+    // 统计实体与组件存储的内存占用，可通过WriteJson输出
+    [[nodiscard]] static WorldMemoryUsage GetMemoryUsage();
+
+    // 批量创建count个实体并追加到outEntities，返回实际创建的数量
+    static size_t CreateEntities(size_t count, std::vector<Entity>& outEntities);
+
+    // 批量销毁实体及其所有组件
+    static void DestroyEntities(std::span<const Entity> entities);
+
 
     // ===============================
     // Component Management
@@ -47,65 +57,236 @@ public:
 
     // 添加组件
     template <typename T, typename... Args>
-        requires std::is_base_of_v<Component<T>, T>
+        requires ComponentType<T>
     static void AddComponent(const Entity& entity, Args&&... args)
     {
-        if (CheckEntity(entity))
-        {
-            auto entityIndex = EntityManager::GetEntityIndex(entity);
-            ComponentManager::Get().AddComponent<T>(entityIndex, std::forward<Args>(args)...);
-        }
+        GetWorld().AddComponent<T>(entity, std::forward<Args>(args)...);
+    }
+
+    // 批量添加组件，entities[i]对应components[i]
+    template <typename T>
+        requires ComponentType<T> && std::is_copy_constructible_v<T> && std::is_copy_assignable_v<T>
+    static void AddComponents(std::span<const Entity> entities, std::span<const T> components)
+    {
+        GetWorld().AddComponents<T>(entities, components);
     }
 
     // 获取组件，如果不存在或实体无效则返回nullptr
     template <typename T>
-        requires std::is_base_of_v<Component<T>, T>
+        requires ComponentType<T>
     static T* GetComponent(const Entity& entity)
     {
-        if (!CheckEntity(entity))
-        {
-            return nullptr;
-        }
-
-        auto entityIndex = EntityManager::GetEntityIndex(entity);
-        return ComponentManager::Get().GetComponent<T>(entityIndex);
+        return GetWorld().GetComponent<T>(entity);
     }
 
     // 是否拥有该组件
     template <typename T>
-        requires std::is_base_of_v<Component<T>, T>
+        requires ComponentType<T>
     static bool HasComponent(const Entity& entity)
     {
-        if (!CheckEntity(entity))
-        {
-            return false;
-        }
-
-        auto entityIndex = EntityManager::GetEntityIndex(entity);
-        return ComponentManager::Get().HasComponent<T>(entityIndex);
+        return GetWorld().HasComponent<T>(entity);
     }
 
     // 移除Entity的某个组件
     template <typename T>
-        requires std::is_base_of_v<Component<T>, T>
+        requires ComponentType<T>
     static void RemoveComponent(const Entity& entity)
     {
-        if (CheckEntity(entity))
-        {
-            auto entityIndex = EntityManager::GetEntityIndex(entity);
-            ComponentManager::Get().RemoveComponent<T>(entityIndex);
-        }
+        GetWorld().RemoveComponent<T>(entity);
     }
 
     // 移除Entity的所有组件
     static void RemoveEntityAllComponents(const Entity& entity);
 
+    // 设置组件存储后端，仅在没有存储任何组件时才能切换
+    static bool SetComponentStorageMode(ComponentStorageMode mode);
+
     // 回调访问特定类型的所有组件
     template <typename T>
-        requires std::is_base_of_v<Component<T>, T>
+        requires ComponentType<T>
     static void ForEachComponent(const std::function<void(T&)>& callback)
     {
-        ComponentManager::Get().ForEachComponent<T>(callback);
+        GetWorld().ForEachComponent<T>(callback);
+    }
+
+    // 使用系统线程池并行访问特定类型的所有组件，func的签名为void(T&)或bool(T&)。未开启多线程时按顺序执行
+    template <typename T, typename Func>
+        requires ComponentType<T>
+    static void ParallelForEach(Func&& func, size_t grainSize = 0)
+    {
+        GetWorld().ParallelForEach<T>(std::forward<Func>(func), grainSize);
+    }
+
+    // 使用系统线程池并行归约特定类型的所有组件，结果与线程数量无关
+    template <typename T, typename TResult, typename MapFunc, typename ReduceFunc>
+        requires ComponentType<T>
+    static TResult ParallelReduce(TResult identity, MapFunc&& map, ReduceFunc&& reduce, size_t grainSize = 0)
+    {
+        return GetWorld().ParallelReduce<T>(std::move(identity), std::forward<MapFunc>(map),
+                                            std::forward<ReduceFunc>(reduce), grainSize);
+    }
+
+    // 回调访问同时拥有Ts...所有组件的实体，func的签名为void(Entity, Ts&...)，两种存储后端均可使用
+    template <typename... Ts, typename Func>
+        requires(sizeof...(Ts) > 0) && (ComponentType<Ts> && ...)
+    static void Each(Func&& func)
+    {
+        GetWorld().Each<Ts...>(std::forward<Func>(func));
+    }
+
+    // 获取同时拥有Ts...所有组件的实体视图(仅SparseSet模式)，支持range-for: for (auto [entity, a, b] : View<A, B>())
+    template <typename... Ts>
+        requires(sizeof...(Ts) > 0) && (ComponentType<Ts> && ...) && TUniqueTypes<Ts...>::value
+    static ComponentView<Ts...> View()
+    {
+        return GetWorld().View<Ts...>();
+    }
+
+    // 按compare对T组件原地排序(仅SparseSet模式)，被组拥有时返回false
+    template <typename T, typename Compare>
+        requires ComponentType<T>
+    static bool Sort(Compare&& compare, ComponentSortMode mode = ComponentSortMode::Full)
+    {
+        return GetWorld().Sort<T>(std::forward<Compare>(compare), mode);
+    }
+
+    // 按U的紧凑顺序重排T(仅SparseSet模式)
+    template <typename T, typename U>
+        requires ComponentType<T> && ComponentType<U>
+    static bool SortAs()
+    {
+        return GetWorld().SortAs<T, U>();
+    }
+
+    // 获取拥有Ts...的组视图，组不存在时创建(仅SparseSet模式)，冲突时返回无效的空视图
+    template <typename... Ts>
+        requires(sizeof...(Ts) > 1) && (ComponentType<Ts> && ...) && TUniqueTypes<Ts...>::value
+                && (!StableComponentType<Ts> && ...)
+    static GroupView<Ts...> Group()
+    {
+        return GetWorld().Group<Ts...>();
+    }
+
+    // 压缩T的稳定地址存储(仅SparseSet模式)，所有T组件的地址都会改变
+    template <typename T>
+        requires StableComponentType<T>
+    static void CompactComponents()
+    {
+        GetWorld().CompactComponents<T>();
+    }
+
+    // 设置T的稳定地址存储在同步点自动压缩的阈值
+    template <typename T>
+        requires StableComponentType<T>
+    static bool SetCompactionThreshold(double threshold)
+    {
+        return GetWorld().SetCompactionThreshold<T>(threshold);
+    }
+
+    // 为T开启变化追踪(仅SparseSet模式)
+    template <typename T>
+        requires ComponentType<T>
+    static bool EnableChangeTracking()
+    {
+        return GetWorld().EnableChangeTracking<T>();
+    }
+
+    // 获取当前Tick
+    static ComponentTick GetCurrentTick();
+
+    // 只读获取组件，不会标记修改
+    template <typename T>
+        requires ComponentType<T>
+    static const T* ReadComponent(const Entity& entity)
+    {
+        return GetWorld().ReadComponent<T>(entity);
+    }
+
+    // 标记组件已被修改
+    template <typename T>
+        requires ComponentType<T>
+    static void MarkChanged(const Entity& entity)
+    {
+        GetWorld().MarkChanged<T>(entity);
+    }
+
+    // 变化查询，TFilter为Added<T>或Changed<T>，func的签名为void(Entity, T&, Ts&...)
+    template <typename TFilter, typename... Ts, typename Func>
+        requires ChangeFilterType<TFilter> && (ComponentType<Ts> && ...)
+    static void Each(ComponentTick sinceTick, Func&& func)
+    {
+        GetWorld().Each<TFilter, Ts...>(sinceTick, std::forward<Func>(func));
+    }
+
+    // 回调访问自sinceTick(含)以来移除了T的实体，func的签名为void(const Entity&)
+    template <typename T, typename Func>
+        requires ComponentType<T>
+    static void ForEachRemoved(ComponentTick sinceTick, Func&& func)
+    {
+        GetWorld().ForEachRemoved<T>(sinceTick, std::forward<Func>(func));
+    }
+
+    // 订阅T的生命周期事件并立即回调，func的签名为void(const Entity&, ComponentEventType, T&)
+    template <typename T, typename Func>
+        requires ComponentType<T>
+    static ComponentObserverID Observe(Func&& func)
+    {
+        return GetWorld().Observe<T>(std::forward<Func>(func));
+    }
+
+    // 订阅T的生命周期事件并批量回调，func的签名为void(std::span<const ComponentEvent>)
+    template <typename T, typename Func>
+        requires ComponentType<T>
+    static ComponentObserverID ObserveBatched(Func&& func)
+    {
+        return GetWorld().ObserveBatched<T>(std::forward<Func>(func));
+    }
+
+    // 取消订阅T的观察者
+    template <typename T>
+        requires ComponentType<T>
+    static bool RemoveObserver(ComponentObserverID id)
+    {
+        return GetWorld().RemoveObserver<T>(id);
+    }
+
+    // 立即把缓冲的组件事件分发给批量观察者
+    static void FlushComponentEvents();
+
+    // ===============================
+    // Resource Management
+    // ===============================
+
+    // 设置资源并返回它的地址，地址在RemoveResource之前保持不变
+    template <typename T, typename... Args>
+        requires ResourceType<T> && std::is_constructible_v<T, Args...>
+    static T* SetResource(Args&&... args)
+    {
+        return GetWorld().SetResource<T>(std::forward<Args>(args)...);
+    }
+
+    // 获取资源，不存在则返回nullptr
+    template <typename T>
+        requires ResourceType<T>
+    static T* GetResource()
+    {
+        return GetWorld().GetResource<T>();
+    }
+
+    // 是否存在该资源
+    template <typename T>
+        requires ResourceType<T>
+    static bool HasResource()
+    {
+        return GetWorld().HasResource<T>();
+    }
+
+    // 移除资源
+    template <typename T>
+        requires ResourceType<T>
+    static bool RemoveResource()
+    {
+        return GetWorld().RemoveResource<T>();
     }
 
     // ===============================
@@ -115,12 +296,21 @@ public:
     // 更新所有系统
     static void UpdateSystems(float deltaTime);
 
+    // 设置并行更新系统的工作线程数量，0表示按顺序更新
+    static void SetSystemWorkerCount(size_t workerCount);
+
+    // 获取系统使用的命令缓冲，在系统中(包括并行执行的系统)通过它延迟创建、销毁实体或增删组件
+    static CommandBuffer& GetCommandBuffer();
+
+    // 获取系统性能分析器，可统计最近若干帧的耗时或导出Chrome trace
+    static SystemProfiler& GetSystemProfiler();
+
     // 注册系统
     template <typename T, typename... Args>
         requires std::is_base_of_v<System<T>, T>
     static T* RegisterSystem(Args&&... args)
     {
-        return SystemManager::Get().RegisterSystem<T>(std::forward<Args>(args)...);
+        return GetWorld().RegisterSystem<T>(std::forward<Args>(args)...);
     }
 
     // 是否存在某个系统
@@ -128,7 +318,7 @@ public:
         requires std::is_base_of_v<System<T>, T>
     static bool HasSystem()
     {
-        return SystemManager::Get().HasSystem<T>();
+        return GetWorld().HasSystem<T>();
     }
 
     // 移除某个系统
@@ -136,7 +326,7 @@ public:
         requires std::is_base_of_v<System<T>, T>
     static void RemoveSystem()
     {
-        SystemManager::Get().RemoveSystem<T>();
+        GetWorld().RemoveSystem<T>();
     }
 
 private:
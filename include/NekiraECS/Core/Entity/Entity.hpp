@@ -8,8 +8,12 @@
 
 #pragma once
 
+#include <NekiraECS/Core/Memory/MemoryUsage.hpp>
 #include <NekiraECS/Core/Primary/PrimaryType.hpp>
+#include <deque>
 #include <functional>
+#include <memory_resource>
+#include <span>
 #include <stack>
 #include <vector>
 
@@ -21,6 +25,7 @@ namespace NekiraECS
 struct Entity final
 {
     friend class EntityManager;
+    friend class CommandBuffer;
 
 public:
     // 外部直接构建的为无效实体
@@ -36,13 +41,13 @@ public:
     ~Entity() = default;
 
 private:
-    // 私有构造函数，仅允许EntityManager创建实体
+    // 私有构造函数，仅允许EntityManager创建实体(CommandBuffer用于创建延迟实体)
     explicit Entity(EntityIDType id) : ID(id)
     {}
 
     // 实体的唯一标识符
-    // 由索引和版本组成 (高16位为索引，低16位为版本)
-    // [Index(16 bits) | Version(16 bits)]
+    // 由索引和版本组成 (高位为索引，低位为版本，具体位数由EntityIDLayout决定)
+    // [Index(INDEX_BITS) | Version(VERSION_BITS)]
     EntityIDType ID;
 };
 
@@ -53,11 +58,18 @@ private:
 namespace NekiraECS
 {
 
-// 实体管理器单例
+// 实体管理器，每个World拥有一个
 class EntityManager final
 {
+    friend class World;
+    friend class WorldSnapshot;
+    friend class SnapshotRing;
+
 public:
-    // 获取单例实例
+    // 可复用实体ID的栈，与版本号数组一样从World的memory_resource分配
+    using RecycledStack = std::stack<EntityIDType, std::pmr::deque<EntityIDType>>;
+
+    // 获取默认World的实体管理器
     static EntityManager& Get();
 
     // 解析实体
@@ -71,26 +83,48 @@ public:
     static EntityVersionType GetEntityVersion(const Entity& entity);
     static EntityVersionType GetEntityVersion(EntityIDType entityID);
 
+    // 获取当前占用该索引的实体(热路径，定义在头文件中以便内联)
+    // 调用者需保证index在范围内，例如该索引来自组件容器
+    [[nodiscard]] Entity GetEntity(EntityIndexType index) const
+    {
+        return Entity((static_cast<EntityIDType>(index) << ENTITY_INDEX_SHIFT) | EntityVersions[index]);
+    }
+
     // 实体是否有效
     [[nodiscard]] bool IsValid(const Entity& entity) const;
     [[nodiscard]] bool IsValid(EntityIDType entityID) const;
 
-    // 创建一个新实体
+    // 创建一个新实体，索引耗尽时返回无效实体
     Entity CreateEntity();
 
     // 销毁一个实体
     void DestroyEntity(const Entity& entity);
 
+    // 批量创建count个实体并追加到outEntities，索引耗尽时提前停止，返回实际创建的数量
+    size_t CreateEntities(size_t count, std::vector<Entity>& outEntities);
+
+    // 批量销毁实体，无效的实体会被忽略
+    void DestroyEntities(std::span<const Entity> entities);
+
     // 获取所有有效的Entity
     [[nodiscard]] std::vector<Entity> GetAllEntities() const;
 
     // 回调访问所有有效实体
     void ForEachEntity(const std::function<void(const Entity&)>& callback) const;
 
+    // 统计实体存储的内存占用
+    [[nodiscard]] EntityMemoryUsage GetMemoryUsage() const;
+
+    // 实体存储使用的memory_resource
+    [[nodiscard]] std::pmr::memory_resource* GetMemoryResource() const;
+
 private:
-    EntityManager() = default;
+    explicit EntityManager(std::pmr::memory_resource* resource);
     ~EntityManager() = default;
 
+    // 计算下一个版本号
+    static EntityVersionType NextVersion(EntityVersionType version);
+
     EntityManager(const EntityManager& other) = delete;
     EntityManager(EntityManager&& other) noexcept = delete;
 
@@ -98,10 +132,10 @@ private:
     EntityManager& operator=(EntityManager&& other) noexcept = delete;
 
     // 每个实体的版本号 EntityIndex -> EntityVersion
-    std::vector<EntityVersionType> EntityVersions;
+    std::pmr::vector<EntityVersionType> EntityVersions;
 
     // 可复用的实体ID.版本号在回收时已做+1处理，因此可以直接复用
-    std::stack<EntityIDType> RecycledIDs;
+    RecycledStack RecycledIDs;
 };
 
 } // namespace NekiraECS
\ No newline at end of file
@@ -0,0 +1,57 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+
+namespace NekiraECS
+{
+
+/**
+ * 从memory_resource分配的对象的删除器
+ *
+ * 分配时记录对象的实际类型，因此可以通过基类指针归还到同一个memory_resource，并按实际类型的大小与对齐释放。
+ */
+template <typename TBase>
+struct TResourceDeleter final
+{
+    std::pmr::memory_resource* Resource = nullptr;
+
+    void (*Destroy)(TBase* object, std::pmr::memory_resource* resource) = nullptr;
+
+    void operator()(TBase* object) const
+    {
+        Destroy(object, Resource);
+    }
+};
+
+// 从memory_resource分配的对象的独占指针
+template <typename TBase>
+using TResourcePtr = std::unique_ptr<TBase, TResourceDeleter<TBase>>;
+
+// 在resource上构造T，返回以TBase持有的独占指针
+template <typename T, typename TBase = T, typename... Args>
+    requires std::is_base_of_v<TBase, T>
+TResourcePtr<TBase> MakeResourcePtr(std::pmr::memory_resource* resource, Args&&... args)
+{
+    std::pmr::polymorphic_allocator<T> allocator(resource);
+
+    T* object = allocator.template new_object<T>(std::forward<Args>(args)...);
+
+    const auto DESTROY = [](TBase* base, std::pmr::memory_resource* owner)
+    { std::pmr::polymorphic_allocator<T>(owner).delete_object(static_cast<T*>(base)); };
+
+    return TResourcePtr<TBase>(object, TResourceDeleter<TBase>{.Resource = resource, .Destroy = DESTROY});
+}
+
+} // namespace NekiraECS
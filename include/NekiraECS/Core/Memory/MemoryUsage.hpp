@@ -0,0 +1,135 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <NekiraECS/Core/Component/Component.hpp>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+namespace NekiraECS
+{
+
+// 某种组件类型(SparseSet模式)的内存占用，单位均为字节
+struct ComponentMemoryUsage final
+{
+    ComponentTypeID TypeID = 0;
+
+    // 类型名(typeid(T).name())
+    std::string Name;
+
+    // 单个组件的大小，标签组件不占用存储，为0
+    size_t ComponentSize = 0;
+
+    // 组件数量与紧凑数组的容量
+    size_t Count = 0;
+    size_t Capacity = 0;
+
+    // 紧凑数组(组件与实体索引)中已使用的部分
+    size_t DenseBytes = 0;
+
+    // 紧凑数组已分配但未使用的容量
+    size_t SlackBytes = 0;
+
+    // 稀疏索引的页与页表
+    size_t SparseIndexBytes = 0;
+
+    // 稀疏索引已分配的页数量
+    size_t SparseIndexPages = 0;
+
+    // 组件数量 / 稀疏索引已分配的槽位数量，越低说明稀疏索引为越少的组件分配了越多的页
+    double OccupancyRatio = 0.0;
+
+    // 变化追踪的Tick数组与日志，未开启时为0
+    size_t TrackingBytes = 0;
+
+    // 添加组件时观察到的最大总占用
+    size_t PeakBytes = 0;
+
+    [[nodiscard]] size_t GetTotalBytes() const
+    {
+        return DenseBytes + SlackBytes + SparseIndexBytes + TrackingBytes;
+    }
+
+    // 以JSON对象输出
+    void WriteJson(std::ostream& stream) const;
+};
+
+
+// ComponentManager的内存占用，单位均为字节
+struct ComponentManagerMemoryUsage final
+{
+    // 每种已创建容器的组件类型，按ComponentTypeID升序
+    std::vector<ComponentMemoryUsage> Types;
+
+    // 所有类型的合计
+    size_t Count = 0;
+    size_t DenseBytes = 0;
+    size_t SlackBytes = 0;
+    size_t SparseIndexBytes = 0;
+    size_t TrackingBytes = 0;
+
+    // ComponentTypeID -> 容器的映射表
+    size_t ArrayTableBytes = 0;
+
+    // Archetype模式下所有Chunk的大小
+    size_t ArchetypeChunkBytes = 0;
+
+    [[nodiscard]] size_t GetTotalBytes() const
+    {
+        return DenseBytes + SlackBytes + SparseIndexBytes + TrackingBytes + ArrayTableBytes + ArchetypeChunkBytes;
+    }
+
+    // 以JSON对象输出
+    void WriteJson(std::ostream& stream) const;
+};
+
+
+// EntityManager的内存占用，单位均为字节
+struct EntityMemoryUsage final
+{
+    // 已分配的实体索引数量与其中有效的实体数量
+    size_t IndexCount = 0;
+    size_t AliveCount = 0;
+
+    // 版本号数组(按容量计算)
+    size_t VersionBytes = 0;
+
+    // 回收ID栈中的元素，不含std::deque的分块开销
+    size_t RecycledBytes = 0;
+
+    [[nodiscard]] size_t GetTotalBytes() const
+    {
+        return VersionBytes + RecycledBytes;
+    }
+
+    // 以JSON对象输出
+    void WriteJson(std::ostream& stream) const;
+};
+
+
+// World中实体与组件存储的内存占用
+struct WorldMemoryUsage final
+{
+    EntityMemoryUsage Entities;
+
+    ComponentManagerMemoryUsage Components;
+
+    [[nodiscard]] size_t GetTotalBytes() const
+    {
+        return Entities.GetTotalBytes() + Components.GetTotalBytes();
+    }
+
+    // 以JSON对象输出
+    void WriteJson(std::ostream& stream) const;
+};
+
+} // namespace NekiraECS
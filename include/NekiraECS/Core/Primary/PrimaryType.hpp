@@ -8,31 +8,107 @@
 
 #pragma once
 
+#include <concepts>
 #include <cstdint>
+#include <type_traits>
+
+
+// 实体ID的总位数，可选32或64。可通过CMake选项NEKIRAECS_ENTITY_ID_BITS配置
+#ifndef NEKIRAECS_ENTITY_ID_BITS
+#define NEKIRAECS_ENTITY_ID_BITS 32
+#endif
+
+// 实体ID中索引所占的位数，其余位为版本号。可通过CMake选项NEKIRAECS_ENTITY_INDEX_BITS配置
+#ifndef NEKIRAECS_ENTITY_INDEX_BITS
+#define NEKIRAECS_ENTITY_INDEX_BITS 16
+#endif
+
 
 namespace NekiraECS
 {
 
-// 实体ID的类型定义. [Index(16 bits) | Version(16 bits)]
+// 能容纳Bits位的最小无符号整数类型
+template <uint8_t Bits>
+using TUnsignedForBits = std::conditional_t<
+    (Bits <= 8), uint8_t,
+    std::conditional_t<(Bits <= 16), uint16_t, std::conditional_t<(Bits <= 32), uint32_t, uint64_t>>>;
+
+
+/**
+ * 实体ID布局策略. [Index(IndexBits) | Version(剩余位数)]
+ *
+ * 例如：
+ * - TEntityIDLayout<uint32_t, 16>: 16位索引 + 16位版本(默认)
+ * - TEntityIDLayout<uint32_t, 24>: 24位索引 + 8位版本
+ * - TEntityIDLayout<uint64_t, 32>: 32位索引 + 32位版本
+ *
+ * @[INFO] 索引的最大值(全1)被保留作为无效值，因此可用的索引为[0, INDEX_MASK - 1]
+ */
+template <std::unsigned_integral TID, uint8_t IndexBits>
+struct TEntityIDLayout final
+{
+    static_assert(IndexBits > 0 && IndexBits < sizeof(TID) * 8, "IndexBits must leave room for the version");
+
+    using IDType = TID;
+
+    static constexpr uint8_t INDEX_BITS = IndexBits;
+    static constexpr uint8_t VERSION_BITS = (sizeof(TID) * 8) - IndexBits;
+
+    using IndexType = TUnsignedForBits<INDEX_BITS>;
+    using VersionType = TUnsignedForBits<VERSION_BITS>;
+
+    // 索引右移位数
+    static constexpr uint8_t INDEX_SHIFT = VERSION_BITS;
+
+    // 版本号掩码
+    static constexpr IDType VERSION_MASK = (static_cast<IDType>(1) << VERSION_BITS) - 1;
+
+    // 索引掩码(右移之后)
+    static constexpr IDType INDEX_MASK = (static_cast<IDType>(1) << INDEX_BITS) - 1;
+
+    // 可用的最大索引
+    static constexpr IndexType INDEX_MAX = static_cast<IndexType>(INDEX_MASK - 1);
+
+    // 无效索引
+    static constexpr IndexType INVALID_INDEX = static_cast<IndexType>(INDEX_MASK);
+};
+
+
+#if NEKIRAECS_ENTITY_ID_BITS == 64
+using EntityIDLayout = TEntityIDLayout<uint64_t, NEKIRAECS_ENTITY_INDEX_BITS>;
+#elif NEKIRAECS_ENTITY_ID_BITS == 32
+using EntityIDLayout = TEntityIDLayout<uint32_t, NEKIRAECS_ENTITY_INDEX_BITS>;
+#else
+#error "NEKIRAECS_ENTITY_ID_BITS must be 32 or 64"
+#endif
+
+
+// 实体ID的类型定义. [Index | Version]，具体位数由EntityIDLayout决定
 // @[INFO]
 // 这里定义成无符号类型，主要原因有以下几点：
 // 1.索引不会为负数
 // 2.无符号类型使得在右移运算时使用的是逻辑右移(高位补0)，而不是算术右移(高位补符号位)，这确保了右移后仍能得到正确的索引值
-using EntityIDType = uint32_t;
+using EntityIDType = EntityIDLayout::IDType;
 
 // 定义一个无效的实体ID常量
 constexpr EntityIDType INVALID_ENTITYID = 0;
 
 // 实体索引的类型定义
-using EntityIndexType = uint16_t;
+using EntityIndexType = EntityIDLayout::IndexType;
 
 // 实体版本的类型定义
-using EntityVersionType = uint16_t;
+using EntityVersionType = EntityIDLayout::VersionType;
 
 // 定义实体ID掩码
-constexpr EntityVersionType ENTITY_VERSION_MASK = 0xFFFF;
+constexpr EntityIDType ENTITY_VERSION_MASK = EntityIDLayout::VERSION_MASK;
 
 // 定义右移位数
-constexpr uint8_t ENTITY_INDEX_SHIFT = 16;
+constexpr uint8_t ENTITY_INDEX_SHIFT = EntityIDLayout::INDEX_SHIFT;
+
+// 可用的最大实体索引
+constexpr EntityIndexType ENTITY_INDEX_MAX = EntityIDLayout::INDEX_MAX;
+
+// 无效的实体索引，也可作为稀疏集合中的无效值
+constexpr EntityIndexType INVALID_ENTITY_INDEX = EntityIDLayout::INVALID_INDEX;
 
-} // namespace NekiraECS
\ No newline at end of file
+} // namespace NekiraECS
@@ -0,0 +1,284 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// 是否编译系统性能分析。可通过CMake选项NEKIRAECS_ENABLE_PROFILER关闭，关闭后记录接口均为空操作
+#ifndef NEKIRAECS_PROFILER_ENABLED
+#define NEKIRAECS_PROFILER_ENABLED 1
+#endif
+
+
+namespace NekiraECS
+{
+
+enum class SystemGroup : uint8_t;
+
+// 性能分析区间ID
+using ProfileScopeID = uint32_t;
+
+// 无效的区间ID
+constexpr ProfileScopeID INVALID_PROFILE_SCOPE_ID = UINT32_MAX;
+
+// 区间的类型
+enum class ProfileScopeKind : uint8_t
+{
+    Frame = 0,
+    SystemGroup,
+    System
+};
+
+// 某个区间在最近若干帧内的耗时统计(纳秒)
+struct ProfileScopeStats final
+{
+    std::string      Name;
+    ProfileScopeKind Kind = ProfileScopeKind::System;
+
+    size_t SampleCount = 0;
+
+    uint64_t MinNanoseconds = 0;
+    uint64_t AvgNanoseconds = 0;
+    uint64_t P99Nanoseconds = 0;
+    uint64_t MaxNanoseconds = 0;
+    uint64_t LastNanoseconds = 0;
+};
+
+// 硬件计数器
+enum class HardwareCounter : uint8_t
+{
+    Cycles = 0,
+    Instructions,
+    L1DataMisses,
+    LastLevelCacheMisses,
+    BranchMisses
+};
+
+// 硬件计数器的数量
+constexpr size_t HARDWARE_COUNTER_COUNT = 5;
+
+// 某个系统在最近若干帧内的硬件计数器统计
+struct SystemCounterStats final
+{
+    std::string Name;
+
+    size_t SampleCount = 0;
+
+    // 所有样本中都可用的计数器，第i位对应HardwareCounter(i)，不可用的计数器总和为0
+    uint32_t AvailableMask = 0;
+
+    // 各计数器的总和，下标为HardwareCounter
+    std::array<uint64_t, HARDWARE_COUNTER_COUNT> Totals{};
+
+    // 系统通过ReportProcessedEntities报告的实体总数
+    uint64_t Entities = 0;
+
+    double InstructionsPerCycle = 0.0;
+
+    // 每个实体的平均值，系统未报告实体数量时为0
+    double L1DataMissesPerEntity = 0.0;
+    double LastLevelCacheMissesPerEntity = 0.0;
+    double BranchMissesPerEntity = 0.0;
+
+    [[nodiscard]] uint64_t GetTotal(HardwareCounter counter) const
+    {
+        return Totals[static_cast<size_t>(counter)];
+    }
+};
+
+/**
+ * 系统性能分析器：记录每帧、每个系统分组以及每个系统的耗时，每个SystemManager拥有一个
+ *
+ * @[INFO] 记录逻辑：
+ *
+ * 1.每个线程在第一次记录时获得一个线程槽位，并写入该槽位独占的环形缓冲。写入只有几次relaxed原子存储，没有锁。
+ * 2.缓冲写满后覆盖最旧的事件，因此只保留每个线程最近BUFFER_CAPACITY个事件。
+ * 3.读取(统计、导出)可以与写入并发进行：读取后再检查写入进度，丢弃读取期间可能已被覆盖的事件。
+ * 4.时间戳来自单调时钟(steady_clock)，单位为纳秒。
+ *
+ * @[NOTE] 同时记录的线程超过MAX_THREADS时，多出的线程的事件会被丢弃并计入GetDroppedCount()
+ */
+class SystemProfiler final
+{
+public:
+    // 是否编译了性能分析
+    static constexpr bool ENABLED = NEKIRAECS_PROFILER_ENABLED != 0;
+
+    // 可同时记录的线程数量
+    static constexpr size_t MAX_THREADS = 64;
+
+    // 每个线程缓冲的事件数量(2的幂)
+    static constexpr size_t BUFFER_CAPACITY = 4096;
+
+    // 统计与导出默认覆盖的帧数
+    static constexpr size_t DEFAULT_FRAME_WINDOW = 120;
+
+    SystemProfiler();
+    ~SystemProfiler();
+
+    SystemProfiler(const SystemProfiler&) = delete;
+    SystemProfiler(SystemProfiler&&) noexcept = delete;
+
+    SystemProfiler& operator=(const SystemProfiler&) = delete;
+    SystemProfiler& operator=(SystemProfiler&&) noexcept = delete;
+
+    // 运行时开关，默认开启。未编译性能分析时始终为false
+    void SetEnabled(bool enabled);
+
+    [[nodiscard]] bool IsEnabled() const
+    {
+        return ENABLED && Enabled.load(std::memory_order_relaxed);
+    }
+
+    // 注册区间，名字与类型相同时返回已有的ID
+    ProfileScopeID RegisterScope(const std::string& name, ProfileScopeKind kind);
+
+    // 帧区间
+    [[nodiscard]] ProfileScopeID GetFrameScope() const;
+
+    // 系统分组区间
+    [[nodiscard]] ProfileScopeID GetGroupScope(SystemGroup group) const;
+
+    // 开始新的一帧，之后记录的事件都属于该帧
+    void BeginFrame();
+
+    // 当前帧序号
+    [[nodiscard]] uint64_t GetFrameIndex() const;
+
+    // 单调时钟的当前时间(纳秒)
+    [[nodiscard]] static uint64_t Now()
+    {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+    }
+
+    // 记录一个区间，可以在任意线程上调用
+    void Record(ProfileScopeID scope, uint64_t startNanoseconds, uint64_t endNanoseconds);
+
+    // 统计最近frameCount帧内每个区间的耗时，只包含有记录的区间
+    [[nodiscard]] std::vector<ProfileScopeStats> CollectStats(size_t frameCount = DEFAULT_FRAME_WINDOW) const;
+
+    // 以Chrome trace_event格式导出最近frameCount帧，可在chrome://tracing或Perfetto中打开
+    void WriteChromeTrace(std::ostream& stream, size_t frameCount = DEFAULT_FRAME_WINDOW) const;
+
+    // 因线程槽位不足而丢弃的事件数量
+    [[nodiscard]] uint64_t GetDroppedCount() const;
+
+    /**
+     * 开启或关闭硬件计数器，开启后在每个系统的OnUpdate前后读取，返回硬件计数器是否已开启
+     *
+     * @[NOTE] 只支持Linux(perf_event_open)。在容器或perf_event_paranoid限制下通常无法打开，此时返回false且不记录。
+     * 每次读取是一次系统调用，开启后记录的系统耗时也会相应增加
+     */
+    bool SetHardwareCountersEnabled(bool enabled);
+
+    [[nodiscard]] bool IsHardwareCountersEnabled() const
+    {
+        return ENABLED && CountersEnabled.load(std::memory_order_relaxed);
+    }
+
+    // 在当前线程上开始一次硬件计数器采样
+    void BeginCounterSample();
+
+    // 结束当前线程上的采样并记录到区间，entities为本次处理的实体数量(未知时为0)
+    void EndCounterSample(ProfileScopeID scope, uint64_t entities);
+
+    // 统计最近frameCount帧内每个系统的硬件计数器，只包含有记录的系统
+    [[nodiscard]] std::vector<SystemCounterStats> CollectCounterStats(size_t frameCount = DEFAULT_FRAME_WINDOW) const;
+
+private:
+    struct ThreadBuffer;
+
+    // 读取出的事件
+    struct EventRecord final
+    {
+        uint64_t       Start;
+        uint64_t       End;
+        ProfileScopeID Scope;
+        uint32_t       Thread;
+    };
+
+    // 区间信息
+    struct ScopeInfo final
+    {
+        std::string      Name;
+        ProfileScopeKind Kind;
+    };
+
+    // 获取当前线程的缓冲，槽位不足时返回nullptr
+    ThreadBuffer* GetThreadBuffer();
+
+    // 复制区间信息
+    [[nodiscard]] std::vector<ScopeInfo> CopyScopes() const;
+
+    // 读取最近frameCount帧的所有事件
+    [[nodiscard]] std::vector<EventRecord> CollectEvents(size_t frameCount) const;
+
+    std::atomic<bool> Enabled{true};
+
+    std::atomic<bool> CountersEnabled{false};
+
+    std::atomic<uint64_t> FrameIndex{0};
+
+    std::atomic<uint64_t> Dropped{0};
+
+    // 线程槽位 -> 缓冲，按需创建
+    std::array<std::atomic<ThreadBuffer*>, MAX_THREADS> Buffers{};
+
+    // 只在注册与读取时加锁
+    mutable std::mutex ScopeMutex;
+
+    std::vector<ScopeInfo> Scopes;
+
+    ProfileScopeID FrameScope = INVALID_PROFILE_SCOPE_ID;
+
+    ProfileScopeID FirstGroupScope = INVALID_PROFILE_SCOPE_ID;
+};
+
+
+// 在作用域内记录一个区间
+class ProfileScope final
+{
+public:
+    ProfileScope(SystemProfiler& profiler, ProfileScopeID scope) :
+        Profiler(profiler), Scope(scope), Start(profiler.IsEnabled() ? SystemProfiler::Now() : 0)
+    {}
+
+    ~ProfileScope()
+    {
+        if (Start != 0)
+        {
+            Profiler.Record(Scope, Start, SystemProfiler::Now());
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope(ProfileScope&&) noexcept = delete;
+
+    ProfileScope& operator=(const ProfileScope&) = delete;
+    ProfileScope& operator=(ProfileScope&&) noexcept = delete;
+
+private:
+    SystemProfiler& Profiler;
+
+    ProfileScopeID Scope;
+
+    uint64_t Start;
+};
+
+} // namespace NekiraECS
@@ -0,0 +1,164 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace NekiraECS
+{
+
+/**
+ * 资源类型约束
+ *
+ * 资源是World级别的全局数据(例如物理配置、输入状态、帧时钟)，每种类型在一个World中最多存在一个实例。
+ * 任意非const的对象类型都可以作为资源，资源不需要可移动。
+ */
+template <typename T>
+concept ResourceType = std::is_object_v<T> && !std::is_const_v<T> && !std::is_volatile_v<T> && !std::is_array_v<T>
+                       && std::is_destructible_v<T>;
+
+// 资源类型ID，与组件类型ID相互独立，每种资源类型在首次使用时分配一个从0开始的稠密ID
+using ResourceTypeID = uint32_t;
+
+// 资源类型ID分配器
+class ResourceTypeRegistry final
+{
+public:
+    // 分配下一个资源类型ID，计数器定义在Core模块中
+    static ResourceTypeID NextID();
+};
+
+// 获取资源类型T的ID。每种类型只会分配一次，之后的调用只是读取一个静态变量
+template <ResourceType T>
+ResourceTypeID GetResourceTypeID()
+{
+    static const ResourceTypeID ID = ResourceTypeRegistry::NextID();
+    return ID;
+}
+
+
+/**
+ * 资源存储，每个World拥有一个
+ *
+ * @[INFO] 存储逻辑：
+ *
+ * 1.每个资源单独分配在堆上，以资源类型ID为下标存放在数组中，查找只是一次数组访问。
+ * 2.资源的地址在移除之前保持不变，再次SetResource会在原地赋值(类型可移动赋值时)，
+ *   因此系统可以在OnInitialize中缓存资源指针，之后无需任何查找。
+ *
+ * @[NOTE] 资源存储不是线程安全的，并行执行的系统可以同时读取资源，但不能同时增删资源
+ */
+class ResourceStore final
+{
+public:
+    ResourceStore() = default;
+    ~ResourceStore() = default;
+
+    ResourceStore(const ResourceStore&) = delete;
+    ResourceStore(ResourceStore&&) noexcept = delete;
+
+    ResourceStore& operator=(const ResourceStore&) = delete;
+    ResourceStore& operator=(ResourceStore&&) noexcept = delete;
+
+    /**
+     * 设置资源并返回它的地址。资源已存在且T可移动赋值时原地赋值，地址不变；
+     * 否则销毁旧资源后重新分配。
+     */
+    template <typename T, typename... Args>
+        requires ResourceType<T> && std::is_constructible_v<T, Args...>
+    T* SetResource(Args&&... args)
+    {
+        const auto TYPE_ID = GetResourceTypeID<T>();
+
+        if (TYPE_ID >= Resources.size())
+        {
+            Resources.resize(static_cast<size_t>(TYPE_ID) + 1);
+        }
+
+        auto& slot = Resources[TYPE_ID];
+
+        if constexpr (std::is_move_assignable_v<T>)
+        {
+            if (slot != nullptr)
+            {
+                auto* resource = static_cast<T*>(slot.get());
+                *resource = T(std::forward<Args>(args)...);
+                return resource;
+            }
+        }
+
+        slot.reset();
+
+        auto* resource = new T(std::forward<Args>(args)...);
+        slot = ResourcePtr(resource, ResourceDeleter{[](void* ptr) { delete static_cast<T*>(ptr); }});
+
+        return resource;
+    }
+
+    // 获取资源，不存在则返回nullptr
+    template <typename T>
+        requires ResourceType<T>
+    [[nodiscard]] T* GetResource() const
+    {
+        const auto TYPE_ID = GetResourceTypeID<T>();
+
+        return TYPE_ID < Resources.size() ? static_cast<T*>(Resources[TYPE_ID].get()) : nullptr;
+    }
+
+    // 是否存在该资源
+    template <typename T>
+        requires ResourceType<T>
+    [[nodiscard]] bool HasResource() const
+    {
+        return GetResource<T>() != nullptr;
+    }
+
+    // 移除资源，之前获取的指针随之失效。资源存在时返回true
+    template <typename T>
+        requires ResourceType<T>
+    bool RemoveResource()
+    {
+        const auto TYPE_ID = GetResourceTypeID<T>();
+
+        if (TYPE_ID >= Resources.size() || Resources[TYPE_ID] == nullptr)
+        {
+            return false;
+        }
+
+        Resources[TYPE_ID].reset();
+        return true;
+    }
+
+    // 移除所有资源
+    void Clear();
+
+private:
+    // 类型擦除的删除器
+    struct ResourceDeleter final
+    {
+        void (*Destroy)(void*) = nullptr;
+
+        void operator()(void* ptr) const
+        {
+            Destroy(ptr);
+        }
+    };
+
+    using ResourcePtr = std::unique_ptr<void, ResourceDeleter>;
+
+    // 每种资源类型对应的资源。ResourceTypeID -> Resource，未设置的位置为空
+    std::vector<ResourcePtr> Resources;
+};
+
+} // namespace NekiraECS
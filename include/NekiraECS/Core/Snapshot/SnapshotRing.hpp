@@ -0,0 +1,120 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <NekiraECS/Core/Component/ComponentManager.hpp>
+#include <NekiraECS/Core/Entity/Entity.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stack>
+#include <vector>
+
+
+namespace NekiraECS
+{
+
+class World;
+
+/**
+ * 回滚快照环：在内存中保存World最近若干帧的实体与组件状态，用于确定性锁步与回滚同步
+ *
+ * @[INFO] 保存与恢复逻辑：
+ *
+ * 1.实体版本号与回收ID每帧整段复制。
+ * 2.每个组件容器带有修改标记。自上次保存以来未被修改的容器不会复制，而是与上一帧共享同一个状态(写时复制)，
+ *   因此没有变化的容器不产生任何复制开销。
+ * 3.环满时覆盖最旧的一帧。被覆盖的状态不再被其他帧共享时复用它的缓冲，稳定运行时不会分配内存。
+ * 4.恢复时只把内容与目标帧不同的容器整段复制回去并重建稀疏索引，组恢复为保存时的实体数量。
+ *
+ * @[NOTE] 修改标记在获取组件容器、可变组件以及增删组件时设置。跨帧保存的组件指针或视图写入的数据无法被检测到，
+ *         应在每帧重新获取。不可复制的组件、以及保存之后被移除的组件容器不会被恢复。
+ *         每个World只应使用一个SnapshotRing(它会清除容器的修改标记)。仅支持SparseSet模式
+ */
+class SnapshotRing final
+{
+public:
+    // 帧号，通常为模拟的Tick
+    using FrameType = uint64_t;
+
+    // 默认保存的帧数
+    static constexpr size_t DEFAULT_CAPACITY = 8;
+
+    // world需要比SnapshotRing存活得更久，capacity为最多保存的帧数(至少为1)
+    explicit SnapshotRing(World& world, size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * 把当前状态保存为frame，环满时覆盖最旧的一帧
+     *
+     * 帧号应单调递增。frame不大于已保存的最新帧时(回滚后重新模拟)，不小于frame的帧会先被丢弃。
+     * Archetype模式下返回false。
+     */
+    bool Save(FrameType frame);
+
+    // 恢复到frame，比frame新的帧会被丢弃，frame本身保留。frame不存在或处于Archetype模式时返回false
+    bool Restore(FrameType frame);
+
+    // 是否保存了frame
+    [[nodiscard]] bool Contains(FrameType frame) const;
+
+    // 已保存的帧数
+    [[nodiscard]] size_t Size() const;
+
+    // 最多保存的帧数
+    [[nodiscard]] size_t GetCapacity() const;
+
+    // 丢弃所有帧
+    void Clear();
+
+private:
+    // 组的状态，以组件类型ID识别
+    struct GroupRecord final
+    {
+        std::vector<ComponentTypeID> TypeIDs;
+
+        size_t Size = 0;
+    };
+
+    // 一帧的状态
+    struct Frame final
+    {
+        FrameType Number = 0;
+
+        std::pmr::vector<EntityVersionType> EntityVersions;
+
+        EntityManager::RecycledStack RecycledIDs;
+
+        // ComponentTypeID -> 组件容器状态，容器不存在或为空时为nullptr
+        std::vector<std::shared_ptr<IComponentArrayState>> States;
+
+        std::vector<GroupRecord> Groups;
+    };
+
+    // 第index旧的帧
+    [[nodiscard]] Frame& GetFrame(size_t index);
+
+    [[nodiscard]] const Frame& GetFrame(size_t index) const;
+
+    // 查找frame的位置，不存在时返回Count
+    [[nodiscard]] size_t FindFrame(FrameType frame) const;
+
+    World* Owner = nullptr;
+
+    // 环形缓冲，Head为最旧的一帧
+    std::vector<Frame> Frames;
+
+    size_t Head = 0;
+
+    size_t Count = 0;
+
+    // 每个组件容器的内容所对应的状态，容器未被修改时两者一致。ComponentTypeID -> 状态
+    std::vector<std::shared_ptr<IComponentArrayState>> CurrentStates;
+};
+
+} // namespace NekiraECS
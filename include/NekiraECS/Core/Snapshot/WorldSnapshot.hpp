@@ -0,0 +1,276 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <NekiraECS/Core/Component/ComponentManager.hpp>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+
+namespace NekiraECS
+{
+
+// 快照写入器，向缓冲末尾追加数据
+class SnapshotWriter final
+{
+public:
+    explicit SnapshotWriter(std::vector<std::byte>& buffer);
+
+    // 追加size字节
+    void Write(const void* data, size_t size);
+
+    // 追加一个可平凡复制的值
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    void Write(const T& value)
+    {
+        Write(&value, sizeof(T));
+    }
+
+    // 以0填充，使当前位置对齐到alignment
+    void Align(size_t alignment);
+
+    // 覆盖position处已写入的数据
+    void Overwrite(size_t position, const void* data, size_t size);
+
+    // 当前位置(已写入的字节数)
+    [[nodiscard]] size_t GetPosition() const;
+
+private:
+    std::vector<std::byte>& Buffer;
+};
+
+
+// 快照读取器，读取越界后进入失败状态，之后的读取都会失败
+class SnapshotReader final
+{
+public:
+    explicit SnapshotReader(std::span<const std::byte> data);
+
+    // 读取size字节到out，失败时返回false
+    bool Read(void* out, size_t size);
+
+    // 读取一个可平凡复制的值，失败时返回false
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    bool Read(T& out)
+    {
+        return Read(&out, sizeof(T));
+    }
+
+    // 是否没有发生过越界读取
+    [[nodiscard]] bool IsGood() const;
+
+    // 剩余的字节数
+    [[nodiscard]] size_t GetRemaining() const;
+
+private:
+    std::span<const std::byte> Data;
+
+    size_t Position = 0;
+
+    bool Good = true;
+};
+
+
+// 类型擦除后的快照组件信息
+struct SnapshotTypeInfo final
+{
+    // 注册名的稳定哈希，用于在不同进程之间识别组件类型
+    uint64_t NameHash;
+
+    ComponentTypeID ID;
+
+    // 按原始字节读写时每个组件的字节数，使用序列化钩子时为0
+    uint32_t ElementSize;
+
+    // 是否按原始字节读写
+    bool IsRaw;
+
+    // 写入该类型所有组件的数据，顺序与组件容器的实体索引一致
+    void (*SaveData)(ComponentManager& components, SnapshotWriter& writer);
+
+    // 读取数据并填充空的组件容器，失败时返回false
+    bool (*LoadData)(ComponentManager& components, std::span<const EntityIndexType> entityIndices,
+                     std::span<const std::byte> data);
+};
+
+
+class World;
+
+/**
+ * 世界快照：把World的实体与组件保存为二进制数据，或从二进制数据中恢复
+ *
+ * @[INFO] 数据布局(所有区段都按SNAPSHOT_ALIGNMENT对齐，偏移量相对于数据起始位置)：
+ *
+ * 1.文件头：魔数、版本、实体ID布局，以及实体版本号区段、回收ID区段与类型表的偏移和长度。
+ * 2.实体版本号(EntityVersions)与回收ID按原始数组写入，加载时整段复制。
+ * 3.类型表的每一项记录注册名的哈希、组件数量、实体索引区段与组件数据区段。
+ * 4.可平凡复制的组件按原始字节写入，加载时对组件数组整段复制；其余组件通过注册的序列化钩子逐个读写。
+ * 5.稀疏索引由指针组成的分页构成，不写入快照，加载时根据实体索引重建。
+ *
+ * @[NOTE] 快照使用本机的字节序与组件内存布局，只能在相同平台、相同实体ID布局的程序之间使用。
+ *         只有注册过的组件类型会被保存，加载时遇到未注册的类型会跳过。仅支持SparseSet模式
+ */
+class WorldSnapshot final
+{
+public:
+    // 快照中每个区段的对齐字节数
+    static constexpr size_t SNAPSHOT_ALIGNMENT = 64;
+
+    // 注册可平凡复制的组件类型，按原始字节读写。name在不同进程之间必须一致且唯一
+    template <typename T>
+        requires ComponentType<T> && std::is_trivially_copyable_v<T>
+    static void RegisterType(std::string_view name)
+    {
+        static_assert(alignof(T) <= SNAPSHOT_ALIGNMENT, "Component alignment exceeds the snapshot section alignment");
+
+        Register(SnapshotTypeInfo{
+            .NameHash = HashName(name),
+            .ID = GetComponentTypeID<T>(),
+            .ElementSize = TagComponentType<T> ? 0U : static_cast<uint32_t>(sizeof(T)),
+            .IsRaw = true,
+            .SaveData =
+                [](ComponentManager& components, SnapshotWriter& writer)
+            {
+                const auto* compArray = components.FindComponentArray<T>();
+
+                if constexpr (StableComponentType<T>)
+                {
+                    // 稳定地址存储不连续，按紧凑顺序逐个写入
+                    for (const auto ENTITY_INDEX : compArray->GetEntityIndices())
+                    {
+                        writer.Write(compArray->ReadComponent(ENTITY_INDEX), sizeof(T));
+                    }
+                }
+                else if constexpr (!TagComponentType<T>)
+                {
+                    writer.Write(compArray->GetComponentData(), compArray->Size() * sizeof(T));
+                }
+            },
+            .LoadData = [](ComponentManager& components, std::span<const EntityIndexType> entityIndices,
+                           std::span<const std::byte> data) -> bool
+            {
+                auto* compArray = GetArray<T>(components);
+
+                // 与组件容器使用同一个memory_resource，AssignDense可以直接接管
+                typename TComponentStorage<T>::Type storage(compArray->GetMemoryResource());
+
+                if constexpr (TagComponentType<T>)
+                {
+                    storage.resize(entityIndices.size());
+                }
+                else
+                {
+                    // 区段的大小与对齐已在清空World之前校验，数据可以直接整段复制
+                    assert(data.size() == entityIndices.size() * sizeof(T)
+                           && reinterpret_cast<uintptr_t>(data.data()) % alignof(T) == 0);
+
+                    const auto* begin = reinterpret_cast<const T*>(data.data());
+                    storage.assign(begin, begin + entityIndices.size());
+                }
+
+                return compArray->AssignDense(entityIndices, std::move(storage));
+            }});
+    }
+
+    // 注册使用序列化钩子的组件类型，deserialize读取失败时应让reader进入失败状态
+    template <typename T>
+        requires ComponentType<T>
+    static void RegisterType(std::string_view name, void (*serialize)(const T&, SnapshotWriter&),
+                             T (*deserialize)(SnapshotReader&))
+    {
+        THooks<T>::Serialize = serialize;
+        THooks<T>::Deserialize = deserialize;
+
+        Register(SnapshotTypeInfo{
+            .NameHash = HashName(name),
+            .ID = GetComponentTypeID<T>(),
+            .ElementSize = 0,
+            .IsRaw = false,
+            .SaveData =
+                [](ComponentManager& components, SnapshotWriter& writer)
+            {
+                const auto* compArray = components.FindComponentArray<T>();
+
+                for (const auto ENTITY_INDEX : compArray->GetEntityIndices())
+                {
+                    THooks<T>::Serialize(*compArray->ReadComponent(ENTITY_INDEX), writer);
+                }
+            },
+            .LoadData = [](ComponentManager& components, std::span<const EntityIndexType> entityIndices,
+                           std::span<const std::byte> data) -> bool
+            {
+                SnapshotReader reader(data);
+
+                auto* compArray = GetArray<T>(components);
+
+                typename TComponentStorage<T>::Type storage(compArray->GetMemoryResource());
+                storage.reserve(entityIndices.size());
+
+                for (size_t index = 0; index < entityIndices.size() && reader.IsGood(); ++index)
+                {
+                    storage.push_back(THooks<T>::Deserialize(reader));
+                }
+
+                if (!reader.IsGood())
+                {
+                    return false;
+                }
+
+                return compArray->AssignDense(entityIndices, std::move(storage));
+            }});
+    }
+
+    // 保存World到outBuffer(覆盖原有内容)，仅支持SparseSet模式
+    static bool Save(World& world, std::vector<std::byte>& outBuffer);
+
+    // 保存World到文件
+    static bool SaveToFile(World& world, const std::string& path);
+
+    /**
+     * 从data恢复World，World中原有的实体与组件会被清除
+     *
+     * 加载前会先校验文件头与所有区段的范围，校验失败时World保持不变。
+     * 使用序列化钩子的组件读取失败时返回false，此时World中只有部分组件。
+     */
+    static bool Load(World& world, std::span<const std::byte> data);
+
+    // 从文件恢复World，整个文件通过一次读取放入对齐的缓冲
+    static bool LoadFromFile(World& world, const std::string& path);
+
+    // 注册名的稳定哈希(FNV-1a)
+    static uint64_t HashName(std::string_view name);
+
+private:
+    template <typename T>
+    struct THooks
+    {
+        static inline void (*Serialize)(const T&, SnapshotWriter&) = nullptr;
+        static inline T (*Deserialize)(SnapshotReader&) = nullptr;
+    };
+
+    // 获取组件容器，不存在则创建
+    template <typename T>
+    static ComponentArray<T>* GetArray(ComponentManager& components)
+    {
+        return components.GetOrCreateComponentArray<T>();
+    }
+
+    // 注册类型信息，相同组件类型重复注册时覆盖
+    static void Register(const SnapshotTypeInfo& info);
+};
+
+} // namespace NekiraECS
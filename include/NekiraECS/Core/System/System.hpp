@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include <NekiraECS/Core/Component/Component.hpp>
+#include <NekiraECS/Core/Profiler/SystemProfiler.hpp>
+#include <algorithm>
 #include <cstdint>
 #include <string>
 #include <typeindex>
@@ -55,9 +58,128 @@ const std::vector<SystemGroup> SYSTEM_GROUPS = {SystemGroup::BeginFrame,   Syste
 
 namespace NekiraECS
 {
+
+/**
+ * 系统的组件访问声明，并行调度时据此判断两个系统能否同时执行
+ *
+ * - Read<Ts...>(): 只读访问。声明为只读的系统可能同时执行，只能通过ReadComponent与只读视图读取；
+ *   GetComponent会标记修改(开启变化追踪时写入追踪日志)，视为写访问，需要声明Write
+ * - Write<Ts...>(): 读写访问
+ * - Exclusive(): 独占执行，与任何系统都冲突
+ *
+ * 未做任何声明的系统视为独占执行，保证旧系统在并行调度下依然安全。
+ */
+class SystemAccess final
+{
+public:
+    SystemAccess() = default;
+
+    // 声明只读访问，此时只能使用ReadComponent读取Ts...，GetComponent视为写访问
+    template <typename... Ts>
+        requires(ComponentType<Ts> && ...)
+    SystemAccess& Read()
+    {
+        (Insert(Reads, GetComponentTypeID<Ts>()), ...);
+        IsDeclared = true;
+        return *this;
+    }
+
+    // 声明读写访问
+    template <typename... Ts>
+        requires(ComponentType<Ts> && ...)
+    SystemAccess& Write()
+    {
+        (Insert(Writes, GetComponentTypeID<Ts>()), ...);
+        IsDeclared = true;
+        return *this;
+    }
+
+    // 声明独占执行
+    SystemAccess& Exclusive()
+    {
+        IsExclusive = true;
+        IsDeclared = true;
+        return *this;
+    }
+
+    // 两个系统的访问是否冲突(至少一方写入了另一方访问的组件，或任意一方独占)
+    [[nodiscard]] bool ConflictsWith(const SystemAccess& other) const
+    {
+        if (!IsDeclared || !other.IsDeclared || IsExclusive || other.IsExclusive)
+        {
+            return true;
+        }
+
+        return Intersects(Writes, other.Writes) || Intersects(Writes, other.Reads) || Intersects(Reads, other.Writes);
+    }
+
+    // 清空声明
+    void Reset()
+    {
+        Reads.clear();
+        Writes.clear();
+        IsDeclared = false;
+        IsExclusive = false;
+    }
+
+private:
+    // 有序插入
+    static void Insert(std::vector<ComponentTypeID>& types, ComponentTypeID typeID)
+    {
+        auto it = std::ranges::lower_bound(types, typeID);
+
+        if (it == types.end() || *it != typeID)
+        {
+            types.insert(it, typeID);
+        }
+    }
+
+    // 两个有序集合是否相交
+    static bool Intersects(const std::vector<ComponentTypeID>& lhs, const std::vector<ComponentTypeID>& rhs)
+    {
+        auto left = lhs.begin();
+        auto right = rhs.begin();
+
+        while (left != lhs.end() && right != rhs.end())
+        {
+            if (*left == *right)
+            {
+                return true;
+            }
+
+            if (*left < *right)
+            {
+                ++left;
+            }
+            else
+            {
+                ++right;
+            }
+        }
+
+        return false;
+    }
+
+    std::vector<ComponentTypeID> Reads;
+    std::vector<ComponentTypeID> Writes;
+
+    bool IsDeclared = false;
+    bool IsExclusive = false;
+};
+
+} // namespace NekiraECS
+
+
+namespace NekiraECS
+{
+class World;
+
 // 系统基础接口
 class ISystemBase
 {
+    friend class SystemManager;
+    friend class SystemContainer;
+
 public:
     ISystemBase() = default;
     ISystemBase(const ISystemBase&) = default;
@@ -88,6 +210,39 @@ public:
     // 系统更新
     virtual void OnUpdate(float deltaTime) = 0;
 
+    // 声明系统读写的组件，系统注册时调用
+    virtual void OnDeclareAccess(SystemAccess& access) const = 0;
+
+    // 获取系统的组件访问声明
+    [[nodiscard]] const SystemAccess& GetAccess() const
+    {
+        return Access;
+    }
+
+    // 重新收集系统的组件访问声明
+    void RefreshAccess()
+    {
+        Access.Reset();
+        OnDeclareAccess(Access);
+    }
+
+    // 获取系统所属的World，系统应通过它而不是Coordinator访问实体与组件
+    [[nodiscard]] World* GetWorld() const
+    {
+        return OwnerWorld;
+    }
+
+    /**
+     * 获取系统上一次执行时的Tick，从未执行过时为0
+     *
+     * 在OnUpdate中以它作为sinceTick查询Added<T>/Changed<T>，即可得到自上次执行以来的所有变化。
+     * 与该系统同一分组、且在它之前执行的系统所做的修改，可能会在下一次执行时被再次报告。
+     */
+    [[nodiscard]] ComponentTick GetLastRunTick() const
+    {
+        return LastRunTick;
+    }
+
     // 系统是否激活
     [[nodiscard]] bool IsSystemActive() const
     {
@@ -100,9 +255,30 @@ public:
         IsActive = active;
     }
 
+    // 在OnUpdate中报告本次处理的实体数量，开启硬件计数器时用于计算每个实体的缓存未命中等平均值
+    void ReportProcessedEntities(size_t count)
+    {
+        ProcessedEntities = count;
+    }
+
 private:
     // 系统是否激活,默认激活
     bool IsActive = true;
+
+    // 系统的组件访问声明
+    SystemAccess Access;
+
+    // 所属的World，注册时由SystemManager设置
+    World* OwnerWorld = nullptr;
+
+    // 上一次执行时的Tick，由SystemContainer在系统执行后设置
+    ComponentTick LastRunTick = 0;
+
+    // 性能分析区间，注册时由SystemManager设置
+    ProfileScopeID ProfilerScope = INVALID_PROFILE_SCOPE_ID;
+
+    // 本次OnUpdate报告的实体数量，开启硬件计数器时在每次执行前清零
+    size_t ProcessedEntities = 0;
 };
 
 
@@ -154,6 +330,10 @@ public:
     void OnUpdate(float deltaTime) override
     {}
 
+    // 声明系统读写的组件，默认不声明(独占执行)
+    void OnDeclareAccess(SystemAccess& /*access*/) const override
+    {}
+
 private:
     System() = default;
     System(const System&) = default;
@@ -8,8 +8,11 @@
 
 #pragma once
 
+#include <NekiraECS/Core/Memory/MemoryResource.hpp>
 #include <NekiraECS/Core/System/System.hpp>
+#include <NekiraECS/Tasks/TaskGraph.hpp>
 #include <memory>
+#include <memory_resource>
 #include <typeindex>
 #include <vector>
 
@@ -22,7 +25,10 @@ namespace NekiraECS
 class SystemContainer final
 {
 public:
-    SystemContainer() = default;
+    // 系统列表从resource分配，系统对象本身由注册时的std::make_unique创建
+    explicit SystemContainer(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : Systems(resource)
+    {}
 
     // 添加系统
     void AddSystem(std::unique_ptr<ISystemBase> system);
@@ -36,19 +42,51 @@ public:
     void SortingSystems();
 
     // 获取所有系统
-    [[nodiscard]] const std::vector<std::unique_ptr<ISystemBase>>& GetAllSystems() const;
+    [[nodiscard]] const std::pmr::vector<std::unique_ptr<ISystemBase>>& GetAllSystems() const;
+
+    /**
+     * 更新所有系统。pool为空时按优先级顺序执行，否则按依赖图并行执行。tick为本次执行的Tick，执行后记录到每个系统
+     * profiler不为空时记录每个系统的耗时
+     */
+    void UpdateSystems(float deltaTime, ThreadPool* pool, ComponentTick tick, SystemProfiler* profiler);
 
 private:
+    // 执行单个系统
+    static void RunSystem(ISystemBase& system, float deltaTime, ComponentTick tick, SystemProfiler* profiler);
+
+    // 根据系统的组件访问声明构建依赖图
+    void BuildSchedule();
+
     bool IsSorted = false;
 
-    std::vector<std::unique_ptr<ISystemBase>> Systems;
+    // 依赖图是否需要重新构建
+    bool IsScheduleDirty = true;
+
+    // 系统依赖图，每个节点对应Systems中的一个系统
+    TaskGraph Schedule;
+
+    // 当前帧的deltaTime，供依赖图中的任务读取
+    float ScheduleDeltaTime = 0.0F;
+
+    // 当前分组的Tick，供依赖图中的任务读取
+    ComponentTick ScheduleTick = 0;
+
+    // 当前分组的性能分析器，供依赖图中的任务读取
+    SystemProfiler* ScheduleProfiler = nullptr;
+
+    std::pmr::vector<std::unique_ptr<ISystemBase>> Systems;
 };
 
 
 // 系统容器句柄，提供对系统容器的访问
 struct SystemContainerHandle final
 {
-    SystemContainerHandle() : Container(std::make_unique<SystemContainer>())
+    SystemContainerHandle() : SystemContainerHandle(std::pmr::get_default_resource())
+    {}
+
+    // 系统容器从resource分配
+    explicit SystemContainerHandle(std::pmr::memory_resource* resource)
+        : Container(MakeResourcePtr<SystemContainer>(resource, resource))
     {}
 
     SystemContainerHandle(const SystemContainerHandle&) = delete;
@@ -79,7 +117,7 @@ struct SystemContainerHandle final
     }
 
 private:
-    std::unique_ptr<SystemContainer> Container;
+    TResourcePtr<SystemContainer> Container;
 };
 
 } // namespace NekiraECS
\ No newline at end of file
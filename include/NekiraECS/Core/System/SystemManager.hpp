@@ -8,7 +8,11 @@
 
 #pragma once
 
+#include <NekiraECS/Core/Command/CommandBuffer.hpp>
 #include <NekiraECS/Core/System/SystemContainer.hpp>
+#include <NekiraECS/Tasks/ThreadPool.hpp>
+#include <memory>
+#include <memory_resource>
 #include <typeindex>
 #include <unordered_map>
 
@@ -17,14 +21,20 @@
 namespace NekiraECS
 {
 
-// 系统管理器
+// 系统管理器，每个World拥有一个
 class SystemManager final
 {
+    friend class World;
+
 public:
+    // 获取默认World的系统管理器
     static SystemManager& Get();
 
 private:
-    SystemManager() = default;
+    SystemManager(World* world, std::pmr::memory_resource* resource)
+        : SystemGroups(resource), DirtyGroups(resource), OwnerWorld(world)
+    {}
+
     ~SystemManager() = default;
 
     SystemManager(const SystemManager&) = delete;
@@ -34,10 +44,10 @@ private:
     SystemManager& operator=(SystemManager&&) noexcept = delete;
 
     // 系统分组映射
-    std::unordered_map<SystemGroup, SystemContainerHandle> SystemGroups;
+    std::pmr::unordered_map<SystemGroup, SystemContainerHandle> SystemGroups;
 
     // 需要重新排序的分组
-    std::vector<SystemGroup> DirtyGroups;
+    std::pmr::vector<SystemGroup> DirtyGroups;
 
     // 标记分组为脏，需要重新排序
     void MarkGroupDirty(SystemGroup group);
@@ -48,10 +58,42 @@ private:
     // 更新所有系统
     void UpdateSystemGroups(float deltaTime);
 
+    // 并行更新系统所用的线程池，为空时按顺序更新
+    std::unique_ptr<ThreadPool> Workers;
+
+    // 系统更新期间记录的结构性修改，每个分组更新结束后回放
+    CommandBuffer Commands;
+
+    // 记录每帧、每个分组与每个系统的耗时
+    SystemProfiler Profiler;
+
+    // 所属的World
+    World* OwnerWorld;
+
 public:
     // 更新所有系统
     void Update(float deltaTime);
 
+    /**
+     * 设置并行更新系统的工作线程数量，0表示按顺序更新(默认)
+     *
+     * 开启后，同一分组内的系统会根据OnDeclareAccess中声明的组件访问构建依赖图，互不冲突的系统并行执行。
+     * @[NOTE] 并行执行的系统中不可直接增删组件或创建、销毁实体，需通过GetCommandBuffer()记录
+     */
+    void SetWorkerCount(size_t workerCount);
+
+    // 获取并行更新系统的工作线程数量
+    [[nodiscard]] size_t GetWorkerCount() const;
+
+    // 获取并行更新系统所用的线程池，未开启多线程时返回nullptr
+    [[nodiscard]] ThreadPool* GetThreadPool() const;
+
+    // 获取系统使用的命令缓冲，其中的命令在每个分组更新结束后回放
+    [[nodiscard]] CommandBuffer& GetCommandBuffer();
+
+    // 获取系统性能分析器
+    [[nodiscard]] SystemProfiler& GetProfiler();
+
     // 注册系统
     template <typename T, typename... Args>
         requires std::is_base_of_v<System<T>, T>
@@ -60,14 +102,23 @@ public:
         auto system = std::make_unique<T>(std::forward<Args>(args)...);
         T*   systemPtr = system.get();
 
+        // 系统通过GetWorld()访问所属的World
+        system->OwnerWorld = OwnerWorld;
+
+        // 同名系统共用一个性能分析区间
+        system->ProfilerScope = Profiler.RegisterScope(system->GetName(), ProfileScopeKind::System);
+
         // 初始化系统
         system->OnInitialize();
 
+        // 收集系统的组件访问声明
+        system->RefreshAccess();
+
         // 添加到对应分组
         SystemGroup group = system->GetGroup();
         if (!SystemGroups.contains(group))
         {
-            SystemGroups[group] = SystemContainerHandle();
+            SystemGroups.try_emplace(group, SystemGroups.get_allocator().resource());
         }
         SystemGroups[group]->AddSystem(std::move(system));
 
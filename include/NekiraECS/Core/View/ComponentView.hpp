@@ -0,0 +1,173 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <NekiraECS/Core/Component/ComponentArray.hpp>
+#include <NekiraECS/Core/Entity/Entity.hpp>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+
+namespace NekiraECS
+{
+
+/**
+ * 多组件视图，用于遍历同时拥有Ts...所有组件的实体
+ *
+ * @[INFO] 遍历逻辑：
+ *
+ * 1.构造时选出Size()最小的组件容器作为驱动容器，只遍历它的EntityIndices，因此复杂度为O(最小集合)。
+ * 2.对于驱动容器中的每个实体索引，通过其余容器的稀疏集合ComponentIndices判断该实体是否拥有所有组件。
+ * 3.所有组件都存在时，返回(Entity, Ts&...)，不经过std::function，循环体可以被内联。
+ *
+ * @[NOTE] 遍历期间不可对Ts...中的组件进行增删(包括销毁实体)，这会使驱动容器失效
+ */
+template <typename... Ts>
+    requires(sizeof...(Ts) > 0) && (ComponentType<Ts> && ...) && TUniqueTypes<Ts...>::value
+class ComponentView final
+{
+public:
+    class Iterator final
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::tuple<Entity, Ts&...>;
+        using pointer = void;
+        using reference = value_type;
+
+        Iterator() = default;
+
+        Iterator(const ComponentView* view, size_t position) : View(view), Position(position)
+        {
+            SkipInvalid();
+        }
+
+        reference operator*() const
+        {
+            return View->MakeTuple((*View->Driver)[Position]);
+        }
+
+        Iterator& operator++()
+        {
+            ++Position;
+            SkipInvalid();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        bool operator==(const Iterator& other) const
+        {
+            return Position == other.Position;
+        }
+
+    private:
+        // 跳过不满足所有组件的实体
+        void SkipInvalid()
+        {
+            const auto SIZE = View->Driver->size();
+
+            while (Position < SIZE && !View->ContainsAll((*View->Driver)[Position]))
+            {
+                ++Position;
+            }
+        }
+
+        const ComponentView* View = nullptr;
+        size_t               Position = 0;
+    };
+
+    ComponentView(const EntityManager* entityManager, ComponentArray<Ts>*... arrays)
+        : Entities(entityManager), Arrays(arrays...)
+    {
+        // 任意一个组件容器不存在，则视图为空
+        if (((arrays == nullptr) || ...))
+        {
+            return;
+        }
+
+        // 选出最小的组件容器作为驱动容器
+        size_t minSize = static_cast<size_t>(-1);
+
+        const auto SELECT_DRIVER = [this, &minSize](const auto* array)
+        {
+            if (array->Size() < minSize)
+            {
+                minSize = array->Size();
+                Driver = &array->GetEntityIndices();
+            }
+        };
+
+        (SELECT_DRIVER(arrays), ...);
+    }
+
+    [[nodiscard]] Iterator begin() const
+    {
+        return Iterator(this, 0);
+    }
+
+    [[nodiscard]] Iterator end() const
+    {
+        return Iterator(this, Driver->size());
+    }
+
+    // 回调访问所有满足条件的实体及其组件，func的签名为void(Entity, Ts&...)
+    template <typename Func>
+    void Each(Func&& func) const
+    {
+        for (const auto ENTITY_INDEX : *Driver)
+        {
+            if (ContainsAll(ENTITY_INDEX))
+            {
+                std::apply(func, MakeTuple(ENTITY_INDEX));
+            }
+        }
+    }
+
+    // 视图遍历次数的上界，即驱动容器的大小
+    [[nodiscard]] size_t SizeHint() const
+    {
+        return Driver->size();
+    }
+
+private:
+    // 是否拥有所有组件
+    [[nodiscard]] bool ContainsAll(EntityIndexType entityIndex) const
+    {
+        return std::apply([entityIndex](const auto*... arrays) { return (arrays->Contains(entityIndex) && ...); },
+                          Arrays);
+    }
+
+    // 组合实体及其组件
+    [[nodiscard]] std::tuple<Entity, Ts&...> MakeTuple(EntityIndexType entityIndex) const
+    {
+        return std::tuple<Entity, Ts&...>(Entities->GetEntity(entityIndex),
+                                          std::get<ComponentArray<Ts>*>(Arrays)->GetComponentUnchecked(entityIndex)...);
+    }
+
+    // 空的驱动容器，用于组件容器不存在时
+    static inline const std::pmr::vector<EntityIndexType> EMPTY_DRIVER{};
+
+    const EntityManager* Entities = nullptr;
+
+    std::tuple<ComponentArray<Ts>*...> Arrays;
+
+    // 驱动容器的EntityIndices
+    const std::pmr::vector<EntityIndexType>* Driver = &EMPTY_DRIVER;
+};
+
+} // namespace NekiraECS
@@ -0,0 +1,150 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <NekiraECS/Core/Component/ComponentGroup.hpp>
+#include <NekiraECS/Core/Entity/Entity.hpp>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+
+
+namespace NekiraECS
+{
+
+/**
+ * 拥有型组的视图，用于遍历同时拥有Ts...所有组件的实体
+ *
+ * 与ComponentView不同，组内实体在每个组件容器中的位置相同，因此遍历时不需要任何稀疏查找，只是对N个数组的线性遍历。
+ *
+ * @[NOTE] 遍历期间不可对Ts...中的组件进行增删(包括销毁实体)，这会改变组内实体的排列
+ */
+template <typename... Ts>
+    requires(sizeof...(Ts) > 1) && (ComponentType<Ts> && ...) && TUniqueTypes<Ts...>::value
+            && (!StableComponentType<Ts> && ...)
+class GroupView final
+{
+public:
+    class Iterator final
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::tuple<Entity, Ts&...>;
+        using pointer = void;
+        using reference = value_type;
+
+        Iterator() = default;
+
+        Iterator(const GroupView* view, size_t position) : View(view), Position(position)
+        {}
+
+        reference operator*() const
+        {
+            return View->MakeTuple(Position);
+        }
+
+        Iterator& operator++()
+        {
+            ++Position;
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        bool operator==(const Iterator& other) const
+        {
+            return Position == other.Position;
+        }
+
+    private:
+        const GroupView* View = nullptr;
+        size_t           Position = 0;
+    };
+
+    // group为空时视图为空
+    GroupView(const EntityManager* entityManager, ComponentGroup<Ts...>* group) : Entities(entityManager), Group(group)
+    {}
+
+    [[nodiscard]] Iterator begin() const
+    {
+        return Iterator(this, 0);
+    }
+
+    [[nodiscard]] Iterator end() const
+    {
+        return Iterator(this, Size());
+    }
+
+    // 回调访问组内所有实体及其组件，func的签名为void(Entity, Ts&...)
+    template <typename Func>
+    void Each(Func&& func) const
+    {
+        const size_t SIZE = Size();
+
+        if (SIZE == 0)
+        {
+            return;
+        }
+
+        const EntityIndexType* entityIndices = Group->GetEntityIndices();
+
+        const std::tuple<Ts*...> DATA(Group->template GetComponentData<Ts>()...);
+
+        for (size_t position = 0; position < SIZE; ++position)
+        {
+            func(Entities->GetEntity(entityIndices[position]), At<Ts>(std::get<Ts*>(DATA), position)...);
+        }
+    }
+
+    // 组内实体数量
+    [[nodiscard]] size_t Size() const
+    {
+        return Group != nullptr ? Group->Size() : 0;
+    }
+
+    // 该视图是否对应一个有效的组
+    [[nodiscard]] bool IsValid() const
+    {
+        return Group != nullptr;
+    }
+
+private:
+    // 组合实体及其组件
+    [[nodiscard]] std::tuple<Entity, Ts&...> MakeTuple(size_t position) const
+    {
+        return std::tuple<Entity, Ts&...>(Entities->GetEntity(Group->GetEntityIndices()[position]),
+                                          At<Ts>(Group->template GetComponentData<Ts>(), position)...);
+    }
+
+    // 按位置访问组件，标签组件只有一个共享实例
+    template <typename T>
+    static T& At(T* data, size_t position)
+    {
+        if constexpr (TagComponentType<T>)
+        {
+            return *data;
+        }
+        else
+        {
+            return data[position];
+        }
+    }
+
+    const EntityManager* Entities = nullptr;
+
+    ComponentGroup<Ts...>* Group = nullptr;
+};
+
+} // namespace NekiraECS
@@ -0,0 +1,513 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <NekiraECS/Core/Command/CommandBuffer.hpp>
+#include <NekiraECS/Core/Component/ComponentManager.hpp>
+#include <NekiraECS/Core/Entity/Entity.hpp>
+#include <NekiraECS/Core/Resource/ResourceStore.hpp>
+#include <NekiraECS/Core/System/SystemManager.hpp>
+#include <NekiraECS/Core/View/ComponentView.hpp>
+#include <NekiraECS/Core/View/GroupView.hpp>
+#include <memory_resource>
+
+
+
+namespace NekiraECS
+{
+
+/**
+ * 世界：拥有独立的实体、组件与系统管理器
+ *
+ * @[INFO] 使用说明：
+ *
+ * 1.不同的World之间不共享任何可变状态，因此可以在不同的线程上同时更新不同的World。
+ * 2.Coordinator的静态接口作用于默认World(GetDefault())，已有的代码无需修改。
+ * 3.系统通过GetWorld()访问自己所属的World。
+ * 4.构造时可以传入memory_resource(例如大页内存池或单调分配器)，实体存储、组件容器及其存储、系统容器都从它分配。
+ *   memory_resource的生命周期需长于World，多个World各用一个memory_resource时互不竞争全局堆的锁。
+ *
+ * @[NOTE] 组件类型ID在所有World之间共享，它只在首次使用某个组件类型时分配一次
+ */
+class World final
+{
+public:
+    explicit World(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    ~World();
+
+    World(const World&) = delete;
+    World(World&&) noexcept = delete;
+
+    World& operator=(const World&) = delete;
+    World& operator=(World&&) noexcept = delete;
+
+    // 获取默认World，Coordinator与各管理器的Get()都作用于它
+    static World& GetDefault();
+
+    // 获取构造时传入的memory_resource
+    [[nodiscard]] std::pmr::memory_resource* GetMemoryResource() const;
+
+    // 获取该World的管理器
+    [[nodiscard]] EntityManager&    GetEntityManager();
+    [[nodiscard]] ComponentManager& GetComponentManager();
+    [[nodiscard]] SystemManager&    GetSystemManager();
+    [[nodiscard]] ResourceStore&    GetResourceStore();
+
+    // ===============================
+    // Entity Management
+    // ===============================
+
+    // 实体是否有效
+    [[nodiscard]] bool CheckEntity(const Entity& entity) const;
+
+    // 创建实体
+    Entity CreateEntity();
+
+    // 销毁实体
+    void DestroyEntity(const Entity& entity);
+
+    // 回调访问所有实体
+    void ForEachEntity(const std::function<void(const Entity&)>& callback) const;
+
+    // 统计实体与组件存储的内存占用，可通过WriteJson输出
+    [[nodiscard]] WorldMemoryUsage GetMemoryUsage() const;
+
+    // 批量创建count个实体并追加到outEntities，返回实际创建的数量
+    size_t CreateEntities(size_t count, std::vector<Entity>& outEntities);
+
+    // 批量销毁实体及其所有组件，无效的实体会被忽略
+    void DestroyEntities(std::span<const Entity> entities);
+
+
+    // ===============================
+    // Component Management
+    // ===============================
+
+    // 添加组件
+    template <typename T, typename... Args>
+        requires ComponentType<T>
+    void AddComponent(const Entity& entity, Args&&... args)
+    {
+        if (CheckEntity(entity))
+        {
+            auto entityIndex = EntityManager::GetEntityIndex(entity);
+            Components.AddComponent<T>(entityIndex, std::forward<Args>(args)...);
+        }
+    }
+
+    // 批量添加组件，entities[i]对应components[i]，无效的实体会被忽略
+    template <typename T>
+        requires ComponentType<T> && std::is_copy_constructible_v<T> && std::is_copy_assignable_v<T>
+    void AddComponents(std::span<const Entity> entities, std::span<const T> components)
+    {
+        const size_t COUNT = std::min(entities.size(), components.size());
+
+        std::vector<EntityIndexType> entityIndices;
+        entityIndices.reserve(COUNT);
+
+        for (size_t index = 0; index < COUNT; ++index)
+        {
+            if (!CheckEntity(entities[index]))
+            {
+                break;
+            }
+
+            entityIndices.push_back(EntityManager::GetEntityIndex(entities[index]));
+        }
+
+        // 全部有效时整段添加，否则逐个添加以跳过无效实体
+        if (entityIndices.size() == COUNT)
+        {
+            Components.AddComponents<T>(entityIndices, components.first(COUNT));
+            return;
+        }
+
+        for (size_t index = 0; index < COUNT; ++index)
+        {
+            AddComponent<T>(entities[index], components[index]);
+        }
+    }
+
+    // 获取组件，如果不存在或实体无效则返回nullptr。视为修改，并行系统中需要声明Write<T>，只读时使用ReadComponent
+    template <typename T>
+        requires ComponentType<T>
+    T* GetComponent(const Entity& entity)
+    {
+        if (!CheckEntity(entity))
+        {
+            return nullptr;
+        }
+
+        auto entityIndex = EntityManager::GetEntityIndex(entity);
+        return Components.GetComponent<T>(entityIndex);
+    }
+
+    // 是否拥有该组件
+    template <typename T>
+        requires ComponentType<T>
+    bool HasComponent(const Entity& entity)
+    {
+        if (!CheckEntity(entity))
+        {
+            return false;
+        }
+
+        auto entityIndex = EntityManager::GetEntityIndex(entity);
+        return Components.HasComponent<T>(entityIndex);
+    }
+
+    // 移除Entity的某个组件
+    template <typename T>
+        requires ComponentType<T>
+    void RemoveComponent(const Entity& entity)
+    {
+        if (CheckEntity(entity))
+        {
+            auto entityIndex = EntityManager::GetEntityIndex(entity);
+            Components.RemoveComponent<T>(entityIndex);
+        }
+    }
+
+    // 移除Entity的所有组件
+    void RemoveEntityAllComponents(const Entity& entity);
+
+    // 设置组件存储后端，仅在没有存储任何组件时才能切换
+    bool SetComponentStorageMode(ComponentStorageMode mode);
+
+    // 回调访问特定类型的所有组件
+    template <typename T>
+        requires ComponentType<T>
+    void ForEachComponent(const std::function<void(T&)>& callback)
+    {
+        Components.ForEachComponent<T>(callback);
+    }
+
+    /**
+     * 使用该World的系统线程池并行访问特定类型的所有组件，func的签名为void(T&)或bool(T&)。未开启多线程时按顺序执行
+     *
+     * grainSize为每段的组件数量(0表示默认值)，Archetype模式下按Chunk的容量向上取整为整数个Chunk
+     */
+    template <typename T, typename Func>
+        requires ComponentType<T>
+    void ParallelForEach(Func&& func, size_t grainSize = 0)
+    {
+        Components.ParallelForEach<T>(Systems.GetThreadPool(), std::forward<Func>(func), grainSize);
+    }
+
+    // 使用该World的系统线程池并行归约特定类型的所有组件，结果与线程数量无关。grainSize的含义与ParallelForEach相同
+    template <typename T, typename TResult, typename MapFunc, typename ReduceFunc>
+        requires ComponentType<T>
+    TResult ParallelReduce(TResult identity, MapFunc&& map, ReduceFunc&& reduce, size_t grainSize = 0)
+    {
+        return Components.ParallelReduce<T>(Systems.GetThreadPool(), std::move(identity), std::forward<MapFunc>(map),
+                                            std::forward<ReduceFunc>(reduce), grainSize);
+    }
+
+    // 回调访问同时拥有Ts...所有组件的实体，func的签名为void(Entity, Ts&...)，两种存储后端均可使用
+    template <typename... Ts, typename Func>
+        requires(sizeof...(Ts) > 0) && (ComponentType<Ts> && ...)
+    void Each(Func&& func)
+    {
+        if (Components.GetStorageMode() == ComponentStorageMode::SparseSet)
+        {
+            View<Ts...>().Each(std::forward<Func>(func));
+            return;
+        }
+
+        const auto& entityManager = Entities;
+
+        Components.GetArchetypeStorage().Each<Ts...>(
+            [&entityManager, &func](EntityIndexType entityIndex, Ts&... components)
+            { func(entityManager.GetEntity(entityIndex), components...); });
+    }
+
+    // 获取同时拥有Ts...所有组件的实体视图(仅SparseSet模式)，支持range-for: for (auto [entity, a, b] : View<A, B>())
+    template <typename... Ts>
+        requires(sizeof...(Ts) > 0) && (ComponentType<Ts> && ...) && TUniqueTypes<Ts...>::value
+    ComponentView<Ts...> View()
+    {
+        return ComponentView<Ts...>(&Entities, Components.GetComponentArray<Ts>()...);
+    }
+
+    // 按compare对T组件原地排序，compare的签名为bool(const T&, const T&)。Incremental模式适合每帧维持几乎有序的数据
+    template <typename T, typename Compare>
+        requires ComponentType<T>
+    bool Sort(Compare&& compare, ComponentSortMode mode = ComponentSortMode::Full)
+    {
+        return Components.SortComponents<T>(std::forward<Compare>(compare), mode);
+    }
+
+    // 按U的紧凑顺序重排T，使两者一起遍历时的访问顺序一致
+    template <typename T, typename U>
+        requires ComponentType<T> && ComponentType<U>
+    bool SortAs()
+    {
+        return Components.SortComponentsAs<T, U>();
+    }
+
+    /**
+     * 获取拥有Ts...的组视图，组不存在时创建(仅SparseSet模式)
+     *
+     * 组内实体在每个组件容器中紧凑且顺序一致地排列，遍历时没有任何稀疏查找。
+     * 每个组件类型只能属于一个组，冲突或处于Archetype模式时返回无效的空视图(IsValid()为false)。
+     */
+    template <typename... Ts>
+        requires(sizeof...(Ts) > 1) && (ComponentType<Ts> && ...) && TUniqueTypes<Ts...>::value
+                && (!StableComponentType<Ts> && ...)
+    GroupView<Ts...> Group()
+    {
+        return GroupView<Ts...>(&Entities, Components.GetOrCreateGroup<Ts...>());
+    }
+
+    /**
+     * 压缩T的稳定地址存储(仅SparseSet模式)：按紧凑顺序重新排列组件并释放所有空洞
+     *
+     * 所有T组件的地址都会改变，ComponentArray<T>::GetAddressEpoch()随之递增。
+     */
+    template <typename T>
+        requires StableComponentType<T>
+    void CompactComponents()
+    {
+        Components.CompactComponents<T>();
+    }
+
+    // 设置T的稳定地址存储在同步点自动压缩的阈值(空闲槽位的比例)，不小于1时只在CompactComponents时压缩
+    template <typename T>
+        requires StableComponentType<T>
+    bool SetCompactionThreshold(double threshold)
+    {
+        return Components.SetCompactionThreshold<T>(threshold);
+    }
+
+    // 为T开启变化追踪(仅SparseSet模式)，之后可以使用Added<T>/Changed<T>查询与ForEachRemoved<T>
+    template <typename T>
+        requires ComponentType<T>
+    bool EnableChangeTracking()
+    {
+        return Components.EnableChangeTracking<T>();
+    }
+
+    // 获取当前Tick
+    [[nodiscard]] ComponentTick GetCurrentTick() const
+    {
+        return Components.GetCurrentTick();
+    }
+
+    // 只读获取组件，不会标记修改。如果不存在或实体无效则返回nullptr
+    template <typename T>
+        requires ComponentType<T>
+    const T* ReadComponent(const Entity& entity)
+    {
+        if (!CheckEntity(entity))
+        {
+            return nullptr;
+        }
+
+        return Components.ReadComponent<T>(EntityManager::GetEntityIndex(entity));
+    }
+
+    // 标记组件已被修改，用于通过视图或Each修改了开启变化追踪的组件之后
+    template <typename T>
+        requires ComponentType<T>
+    void MarkChanged(const Entity& entity)
+    {
+        if (CheckEntity(entity))
+        {
+            Components.MarkChanged<T>(EntityManager::GetEntityIndex(entity));
+        }
+    }
+
+    /**
+     * 变化查询：回调访问自sinceTick(含)以来T发生了变化、且同时拥有Ts...的实体，func的签名为void(Entity, T&, Ts&...)
+     *
+     * TFilter为Added<T>或Changed<T>，T需要已开启变化追踪。遍历由T的变化日志驱动，开销与变化数量成正比。
+     * 在系统中通常以GetLastRunTick()作为sinceTick: Each<Changed<Transform>, Velocity>(GetLastRunTick(), func)
+     */
+    template <typename TFilter, typename... Ts, typename Func>
+        requires ChangeFilterType<TFilter> && (ComponentType<Ts> && ...)
+    void Each(ComponentTick sinceTick, Func&& func)
+    {
+        using T = typename TFilter::Type;
+
+        auto* driver = Components.GetComponentArray<T>();
+
+        const std::tuple<ComponentArray<Ts>*...> OTHERS(Components.GetComponentArray<Ts>()...);
+
+        if (driver == nullptr || ((std::get<ComponentArray<Ts>*>(OTHERS) == nullptr) || ...))
+        {
+            return;
+        }
+
+        driver->ForEachSince(TFilter::KIND, sinceTick,
+                             [this, &OTHERS, &func](EntityIndexType entityIndex, T& component)
+                             {
+                                 if ((std::get<ComponentArray<Ts>*>(OTHERS)->Contains(entityIndex) && ...))
+                                 {
+                                     func(Entities.GetEntity(entityIndex), component,
+                                          std::get<ComponentArray<Ts>*>(OTHERS)->GetComponentUnchecked(entityIndex)...);
+                                 }
+                             });
+    }
+
+    // 回调访问自sinceTick(含)以来移除了T的实体(包括被销毁的实体)，func的签名为void(const Entity&)
+    template <typename T, typename Func>
+        requires ComponentType<T>
+    void ForEachRemoved(ComponentTick sinceTick, Func&& func)
+    {
+        const auto* compArray = Components.FindComponentArray<T>();
+
+        if (compArray != nullptr && compArray->GetTracker() != nullptr)
+        {
+            compArray->GetTracker()->ForEachRemoved(sinceTick, std::forward<Func>(func));
+        }
+    }
+
+    /**
+     * 订阅T的生命周期事件并立即回调，func的签名为void(const Entity&, ComponentEventType, T&)(仅SparseSet模式)
+     *
+     * 回调中不可增删T，需要时使用CommandBuffer，记录的命令在下一个同步点执行。
+     * Archetype模式下返回INVALID_COMPONENT_OBSERVER_ID。
+     */
+    template <typename T, typename Func>
+        requires ComponentType<T>
+    ComponentObserverID Observe(Func&& func)
+    {
+        auto* observers = Components.GetOrCreateObservers<T>();
+
+        if (observers == nullptr)
+        {
+            return INVALID_COMPONENT_OBSERVER_ID;
+        }
+
+        return observers->AddImmediate(
+            [func = std::forward<Func>(func)](const Entity& entity, ComponentEventType type, void* component) mutable
+            { func(entity, type, *static_cast<T*>(component)); });
+    }
+
+    /**
+     * 订阅T的生命周期事件并批量回调，func的签名为void(std::span<const ComponentEvent>)(仅SparseSet模式)
+     *
+     * 事件按发生顺序收集在连续的缓冲中，每个系统分组结束后(或调用FlushComponentEvents时)回调一次。
+     * 分发时Destroy事件对应的组件已被移除，Construct事件对应的组件也可能已被移除。
+     */
+    template <typename T, typename Func>
+        requires ComponentType<T>
+    ComponentObserverID ObserveBatched(Func&& func)
+    {
+        auto* observers = Components.GetOrCreateObservers<T>();
+
+        if (observers == nullptr)
+        {
+            return INVALID_COMPONENT_OBSERVER_ID;
+        }
+
+        return observers->AddBatched(std::forward<Func>(func));
+    }
+
+    // 取消订阅T的观察者，成功返回true
+    template <typename T>
+        requires ComponentType<T>
+    bool RemoveObserver(ComponentObserverID id)
+    {
+        const auto* compArray = Components.FindComponentArray<T>();
+
+        return compArray != nullptr && compArray->GetObservers() != nullptr && compArray->GetObservers()->Remove(id);
+    }
+
+    // 立即把缓冲的组件事件分发给批量观察者，用于在系统更新之外处理事件
+    void FlushComponentEvents();
+
+    // ===============================
+    // Resource Management
+    // ===============================
+
+    // 设置资源并返回它的地址，地址在RemoveResource之前保持不变(T可移动赋值时，重复设置也不会改变地址)
+    template <typename T, typename... Args>
+        requires ResourceType<T> && std::is_constructible_v<T, Args...>
+    T* SetResource(Args&&... args)
+    {
+        return Resources.SetResource<T>(std::forward<Args>(args)...);
+    }
+
+    // 获取资源，不存在则返回nullptr。系统可以缓存返回的指针
+    template <typename T>
+        requires ResourceType<T>
+    [[nodiscard]] T* GetResource() const
+    {
+        return Resources.GetResource<T>();
+    }
+
+    // 是否存在该资源
+    template <typename T>
+        requires ResourceType<T>
+    [[nodiscard]] bool HasResource() const
+    {
+        return Resources.HasResource<T>();
+    }
+
+    // 移除资源，之前获取的指针随之失效
+    template <typename T>
+        requires ResourceType<T>
+    bool RemoveResource()
+    {
+        return Resources.RemoveResource<T>();
+    }
+
+    // ===============================
+    // System Management
+    // ===============================
+
+    // 更新所有系统
+    void UpdateSystems(float deltaTime);
+
+    // 设置并行更新系统的工作线程数量，0表示按顺序更新
+    void SetSystemWorkerCount(size_t workerCount);
+
+    // 获取系统使用的命令缓冲，在系统中(包括并行执行的系统)通过它延迟创建、销毁实体或增删组件
+    CommandBuffer& GetCommandBuffer();
+
+    // 获取系统性能分析器，可统计最近若干帧的耗时或导出Chrome trace
+    SystemProfiler& GetSystemProfiler();
+
+    // 注册系统
+    template <typename T, typename... Args>
+        requires std::is_base_of_v<System<T>, T>
+    T* RegisterSystem(Args&&... args)
+    {
+        return Systems.RegisterSystem<T>(std::forward<Args>(args)...);
+    }
+
+    // 是否存在某个系统
+    template <typename T>
+        requires std::is_base_of_v<System<T>, T>
+    bool HasSystem()
+    {
+        return Systems.HasSystem<T>();
+    }
+
+    // 移除某个系统
+    template <typename T>
+        requires std::is_base_of_v<System<T>, T>
+    void RemoveSystem()
+    {
+        Systems.RemoveSystem<T>();
+    }
+
+private:
+    // 所有管理器共用的memory_resource
+    std::pmr::memory_resource* MemoryResource;
+
+    // 声明顺序即构造顺序，析构时系统最先销毁，此时实体、组件与资源仍然有效
+    EntityManager    Entities;
+    ComponentManager Components;
+    ResourceStore    Resources;
+    SystemManager    Systems;
+};
+
+} // namespace NekiraECS
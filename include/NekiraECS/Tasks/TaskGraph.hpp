@@ -0,0 +1,79 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <NekiraECS/Tasks/ThreadPool.hpp>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+
+namespace NekiraECS
+{
+
+// 任务ID
+using TaskID = size_t;
+
+/**
+ * 任务依赖图(DAG)
+ *
+ * 构建一次后可以重复执行。执行时入度为0的任务先被提交，每个任务完成后递减其后继的剩余依赖数，
+ * 归零的后继随即被提交到线程池，因此没有依赖关系的任务会并行执行。
+ */
+class TaskGraph final
+{
+public:
+    TaskGraph() = default;
+    ~TaskGraph() = default;
+
+    TaskGraph(const TaskGraph&) = delete;
+    TaskGraph(TaskGraph&&) noexcept = default;
+
+    TaskGraph& operator=(const TaskGraph&) = delete;
+    TaskGraph& operator=(TaskGraph&&) noexcept = default;
+
+    // 添加任务，返回任务ID
+    TaskID AddTask(std::function<void()> func);
+
+    // 添加依赖：after必须在before完成后才能执行
+    void AddDependency(TaskID before, TaskID after);
+
+    // 任务数量
+    [[nodiscard]] size_t Size() const;
+
+    // 清空所有任务
+    void Clear();
+
+    // 在线程池上执行所有任务，阻塞直到全部完成
+    void Run(ThreadPool& pool);
+
+private:
+    struct Node final
+    {
+        std::function<void()> Func;
+
+        // 后继任务
+        std::vector<TaskID> Successors;
+
+        // 前驱任务数量
+        size_t Predecessors = 0;
+    };
+
+    // 执行某个任务，并提交就绪的后继任务
+    void Execute(TaskID task, ThreadPool& pool, TaskCounter& counter);
+
+    std::vector<Node> Nodes;
+
+    // 每次执行时每个任务剩余的依赖数
+    std::unique_ptr<std::atomic<size_t>[]> RemainingDependencies;
+};
+
+} // namespace NekiraECS
@@ -0,0 +1,12 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <NekiraECS/Tasks/TaskGraph.hpp>
+#include <NekiraECS/Tasks/ThreadPool.hpp>
@@ -0,0 +1,172 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace NekiraECS
+{
+
+// 任务计数器，用于等待一批任务完成
+class TaskCounter final
+{
+public:
+    TaskCounter() = default;
+
+    TaskCounter(const TaskCounter&) = delete;
+    TaskCounter& operator=(const TaskCounter&) = delete;
+
+    // 增加待完成的任务数量
+    void Add(size_t count)
+    {
+        Pending.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    // 标记一个任务完成
+    void Done()
+    {
+        Pending.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    // 是否所有任务都已完成
+    [[nodiscard]] bool IsDone() const
+    {
+        return Pending.load(std::memory_order_acquire) == 0;
+    }
+
+private:
+    std::atomic<size_t> Pending{0};
+};
+
+} // namespace NekiraECS
+
+
+
+namespace NekiraECS
+{
+
+/**
+ * 工作窃取线程池
+ *
+ * @[INFO] 调度逻辑：
+ *
+ * 1.每个工作线程拥有自己的任务队列。工作线程提交的任务放入自己队列的尾部，外部线程提交的任务轮流放入各个队列。
+ * 2.工作线程优先从自己队列的尾部取任务(LIFO，缓存友好)，自己的队列为空时从其他队列的头部窃取任务。
+ * 3.等待任务完成的线程(包括外部线程)会在Wait中帮忙执行任务，因此嵌套的并行任务不会死锁，0个工作线程时也能正常执行。
+ */
+class ThreadPool final
+{
+public:
+    using Task = std::function<void()>;
+
+    // workerCount为工作线程数量，调用Wait的线程也会参与执行
+    explicit ThreadPool(size_t workerCount);
+
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) noexcept = delete;
+
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool& operator=(ThreadPool&&) noexcept = delete;
+
+    // 默认的工作线程数量：硬件线程数 - 1(调用线程也会参与执行)
+    static size_t GetDefaultWorkerCount();
+
+    // 工作线程数量
+    [[nodiscard]] size_t GetWorkerCount() const;
+
+    // 提交任务
+    void Submit(Task task);
+
+    // 尝试在当前线程上执行一个任务，执行了任务则返回true
+    bool TryRunOne();
+
+    // 等待计数器归零，等待期间帮忙执行任务
+    void Wait(const TaskCounter& counter);
+
+    // 将[0, count)按grainSize划分为若干段并行执行，func的签名为void(size_t begin, size_t end)
+    template <typename Func>
+    void ParallelFor(size_t count, size_t grainSize, Func&& func)
+    {
+        grainSize = grainSize == 0 ? 1 : grainSize;
+
+        const size_t RANGE_COUNT = (count + grainSize - 1) / grainSize;
+
+        if (RANGE_COUNT <= 1 || Workers.empty())
+        {
+            if (count > 0)
+            {
+                func(size_t{0}, count);
+            }
+            return;
+        }
+
+        TaskCounter counter;
+        counter.Add(RANGE_COUNT - 1);
+
+        for (size_t range = 1; range < RANGE_COUNT; ++range)
+        {
+            const size_t BEGIN = range * grainSize;
+            const size_t END = BEGIN + grainSize < count ? BEGIN + grainSize : count;
+
+            Submit(
+                [&func, &counter, BEGIN, END]
+                {
+                    func(BEGIN, END);
+                    counter.Done();
+                });
+        }
+
+        // 调用线程执行第一段
+        func(size_t{0}, grainSize);
+
+        Wait(counter);
+    }
+
+private:
+    struct WorkerQueue final
+    {
+        std::mutex       Mutex;
+        std::deque<Task> Tasks;
+    };
+
+    // 工作线程主循环
+    void WorkerLoop(size_t workerIndex);
+
+    // 取出一个任务，优先从preferred队列尾部取，否则从其他队列头部窃取
+    bool PopTask(size_t preferred, Task& outTask);
+
+    std::vector<std::unique_ptr<WorkerQueue>> Queues;
+
+    std::vector<std::thread> Workers;
+
+    // 空闲工作线程在此休眠
+    std::mutex              SleepMutex;
+    std::condition_variable SleepCondition;
+
+    // 队列中尚未被取出的任务数量
+    std::atomic<size_t> QueuedTasks{0};
+
+    // 外部线程提交任务时轮流选择的队列
+    std::atomic<size_t> NextQueue{0};
+
+    std::atomic<bool> Stopping{false};
+};
+
+} // namespace NekiraECS
@@ -0,0 +1,236 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#include <Archetype/Archetype.hpp>
+#include <algorithm>
+
+
+namespace NekiraECS
+{
+
+namespace
+{
+// 将offset向上对齐到alignment
+size_t AlignUp(size_t offset, size_t alignment)
+{
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+// 计算容量为capacity时的Chunk布局，返回所需字节数
+size_t ComputeLayout(const std::vector<const ComponentTypeInfo*>& types, size_t capacity,
+                     std::vector<size_t>& outOffsets)
+{
+    outOffsets.clear();
+
+    size_t offset = capacity * sizeof(EntityIndexType);
+
+    for (const auto* info : types)
+    {
+        offset = AlignUp(offset, info->Align);
+        outOffsets.push_back(offset);
+        offset += capacity * info->Size;
+    }
+
+    return offset;
+}
+} // namespace
+
+
+Archetype::Archetype(std::vector<const ComponentTypeInfo*> types) : Types(std::move(types))
+{
+    size_t rowBytes = sizeof(EntityIndexType);
+
+    // Types按ID有序，最后一个类型的ID最大
+    if (!Types.empty())
+    {
+        ColumnLookup.resize(static_cast<size_t>(Types.back()->ID) + 1, INVALID_COLUMN);
+    }
+
+    for (size_t column = 0; column < Types.size(); ++column)
+    {
+        ColumnLookup[Types[column]->ID] = column;
+        rowBytes += Types[column]->Size;
+    }
+
+    /**
+     * @[INFO] 容量计算：
+     *
+     * 1.先按每行的字节数估算一个Chunk能容纳的行数。
+     * 2.由于每一列都需要对齐，实际布局可能超出CHUNK_SIZE，因此逐步减小容量直到放得下。
+     * 3.如果单行就超过了CHUNK_SIZE，则该原型的Chunk扩大到恰好容纳一行。
+     */
+    ChunkCapacity = std::max<size_t>(CHUNK_SIZE / rowBytes, 1);
+
+    while (ChunkCapacity > 1 && ComputeLayout(Types, ChunkCapacity, ColumnOffsets) > CHUNK_SIZE)
+    {
+        --ChunkCapacity;
+    }
+
+    ChunkBytes = AlignUp(std::max(ComputeLayout(Types, ChunkCapacity, ColumnOffsets), CHUNK_SIZE), CHUNK_ALIGNMENT);
+}
+
+
+Archetype::~Archetype()
+{
+    for (size_t row = 0; row < Count; ++row)
+    {
+        for (size_t column = 0; column < Types.size(); ++column)
+        {
+            Types[column]->Destroy(GetComponentData(column, row));
+        }
+    }
+
+    for (auto* chunk : Chunks)
+    {
+        ::operator delete(chunk, std::align_val_t{CHUNK_ALIGNMENT});
+    }
+}
+
+
+const std::vector<const ComponentTypeInfo*>& Archetype::GetTypes() const
+{
+    return Types;
+}
+
+
+size_t Archetype::Size() const
+{
+    return Count;
+}
+
+
+size_t Archetype::GetChunkCapacity() const
+{
+    return ChunkCapacity;
+}
+
+
+size_t Archetype::GetChunkCount() const
+{
+    return Chunks.size();
+}
+
+
+size_t Archetype::GetChunkBytes() const
+{
+    return ChunkBytes;
+}
+
+
+size_t Archetype::GetChunkSize(size_t chunkIndex) const
+{
+    const size_t BEGIN = chunkIndex * ChunkCapacity;
+
+    return std::min(Count - BEGIN, ChunkCapacity);
+}
+
+
+size_t Archetype::AllocateRow(EntityIndexType entityIndex)
+{
+    const size_t ROW = Count;
+
+    // 当前所有Chunk都已满，分配新的Chunk
+    if (ROW == Chunks.size() * ChunkCapacity)
+    {
+        Chunks.push_back(static_cast<std::byte*>(::operator new(ChunkBytes, std::align_val_t{CHUNK_ALIGNMENT})));
+    }
+
+    GetChunkEntities(ROW / ChunkCapacity)[ROW % ChunkCapacity] = entityIndex;
+
+    ++Count;
+
+    return ROW;
+}
+
+
+bool Archetype::RemoveRow(size_t row, EntityIndexType& outMovedEntity)
+{
+    const size_t LAST_ROW = Count - 1;
+    const bool   MOVED = row != LAST_ROW;
+
+    for (size_t column = 0; column < Types.size(); ++column)
+    {
+        void* data = GetComponentData(column, row);
+
+        Types[column]->Destroy(data);
+
+        // 用最后一行填补空位
+        if (MOVED)
+        {
+            void* lastData = GetComponentData(column, LAST_ROW);
+
+            Types[column]->MoveConstruct(data, lastData);
+            Types[column]->Destroy(lastData);
+        }
+    }
+
+    if (MOVED)
+    {
+        outMovedEntity = GetEntityIndex(LAST_ROW);
+        GetChunkEntities(row / ChunkCapacity)[row % ChunkCapacity] = outMovedEntity;
+    }
+
+    --Count;
+
+    // 释放末尾的空Chunk
+    if (Count == (Chunks.size() - 1) * ChunkCapacity)
+    {
+        ::operator delete(Chunks.back(), std::align_val_t{CHUNK_ALIGNMENT});
+        Chunks.pop_back();
+    }
+
+    return MOVED;
+}
+
+
+EntityIndexType Archetype::GetEntityIndex(size_t row) const
+{
+    return GetChunkEntities(row / ChunkCapacity)[row % ChunkCapacity];
+}
+
+
+void* Archetype::GetComponentData(size_t column, size_t row) const
+{
+    return Chunks[row / ChunkCapacity] + ColumnOffsets[column] + ((row % ChunkCapacity) * Types[column]->Size);
+}
+
+
+EntityIndexType* Archetype::GetChunkEntities(size_t chunkIndex) const
+{
+    return reinterpret_cast<EntityIndexType*>(Chunks[chunkIndex]);
+}
+
+
+Archetype* Archetype::GetAddEdge(ComponentTypeID typeID) const
+{
+    auto it = AddEdges.find(typeID);
+
+    return it != AddEdges.end() ? it->second : nullptr;
+}
+
+
+void Archetype::SetAddEdge(ComponentTypeID typeID, Archetype* target)
+{
+    AddEdges[typeID] = target;
+}
+
+
+Archetype* Archetype::GetRemoveEdge(ComponentTypeID typeID) const
+{
+    auto it = RemoveEdges.find(typeID);
+
+    return it != RemoveEdges.end() ? it->second : nullptr;
+}
+
+
+void Archetype::SetRemoveEdge(ComponentTypeID typeID, Archetype* target)
+{
+    RemoveEdges[typeID] = target;
+}
+
+} // namespace NekiraECS
@@ -0,0 +1,237 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#include <Archetype/ArchetypeStorage.hpp>
+#include <algorithm>
+
+
+namespace NekiraECS
+{
+
+void ArchetypeStorage::RemoveEntityAllComponents(EntityIndexType entityIndex)
+{
+    auto* owner = GetArchetype(entityIndex);
+
+    if (owner == nullptr)
+    {
+        return;
+    }
+
+    RemoveRow(owner, EntityLocations[entityIndex].Row);
+
+    EntityLocations[entityIndex] = EntityLocation{};
+}
+
+
+bool ArchetypeStorage::IsEmpty() const
+{
+    return std::ranges::all_of(Archetypes, [](const auto& archetype) { return archetype->Size() == 0; });
+}
+
+
+size_t ArchetypeStorage::GetArchetypeCount() const
+{
+    return Archetypes.size();
+}
+
+
+size_t ArchetypeStorage::GetChunkMemoryBytes() const
+{
+    size_t bytes = 0;
+
+    for (const auto& archetype : Archetypes)
+    {
+        bytes += archetype->GetChunkCount() * archetype->GetChunkBytes();
+    }
+
+    return bytes;
+}
+
+
+void ArchetypeStorage::Clear()
+{
+    EntityLocations.clear();
+    ArchetypeLookup.clear();
+    Archetypes.clear();
+}
+
+
+std::vector<ArchetypeStorage::ChunkRef> ArchetypeStorage::CollectChunks(ComponentTypeID typeID) const
+{
+    std::vector<ChunkRef> chunks;
+
+    for (const auto& archetype : Archetypes)
+    {
+        const size_t COLUMN = archetype->FindColumn(typeID);
+
+        if (COLUMN == Archetype::INVALID_COLUMN)
+        {
+            continue;
+        }
+
+        for (size_t chunk = 0; chunk < archetype->GetChunkCount(); ++chunk)
+        {
+            chunks.push_back(ChunkRef{.Owner = archetype.get(), .Column = COLUMN, .Chunk = chunk});
+        }
+    }
+
+    return chunks;
+}
+
+
+size_t ArchetypeStorage::GetChunkGrain(const std::vector<ChunkRef>& chunks, size_t grainSize)
+{
+    size_t capacity = 1;
+
+    for (const auto& chunk : chunks)
+    {
+        capacity = std::max(capacity, chunk.Owner->GetChunkCapacity());
+    }
+
+    return std::max<size_t>(1, (grainSize + capacity - 1) / capacity);
+}
+
+
+Archetype* ArchetypeStorage::GetArchetype(EntityIndexType entityIndex) const
+{
+    return entityIndex < EntityLocations.size() ? EntityLocations[entityIndex].Owner : nullptr;
+}
+
+
+Archetype* ArchetypeStorage::GetOrCreateArchetype(std::vector<const ComponentTypeInfo*> types)
+{
+    std::vector<ComponentTypeID> signature;
+    signature.reserve(types.size());
+
+    for (const auto* info : types)
+    {
+        signature.push_back(info->ID);
+    }
+
+    if (auto it = ArchetypeLookup.find(signature); it != ArchetypeLookup.end())
+    {
+        return it->second;
+    }
+
+    auto* archetype = Archetypes.emplace_back(std::make_unique<Archetype>(std::move(types))).get();
+
+    ArchetypeLookup.emplace(std::move(signature), archetype);
+
+    return archetype;
+}
+
+
+Archetype* ArchetypeStorage::GetAddTarget(Archetype* source, const ComponentTypeInfo* info)
+{
+    // 优先使用缓存的原型转移
+    if (source != nullptr)
+    {
+        if (auto* cached = source->GetAddEdge(info->ID))
+        {
+            return cached;
+        }
+    }
+
+    std::vector<const ComponentTypeInfo*> types;
+
+    if (source != nullptr)
+    {
+        types = source->GetTypes();
+    }
+
+    // 保持组件集合有序
+    const auto POSITION = std::ranges::lower_bound(types, info->ID, {}, &ComponentTypeInfo::ID);
+    types.insert(POSITION, info);
+
+    auto* target = GetOrCreateArchetype(std::move(types));
+
+    // 缓存双向的转移
+    if (source != nullptr)
+    {
+        source->SetAddEdge(info->ID, target);
+        target->SetRemoveEdge(info->ID, source);
+    }
+
+    return target;
+}
+
+
+Archetype* ArchetypeStorage::GetRemoveTarget(Archetype* source, ComponentTypeID typeID)
+{
+    // 移除后组件集合为空，实体不再存放在任何原型中
+    if (source->GetTypes().size() == 1)
+    {
+        return nullptr;
+    }
+
+    if (auto* cached = source->GetRemoveEdge(typeID))
+    {
+        return cached;
+    }
+
+    auto types = source->GetTypes();
+
+    std::erase_if(types, [typeID](const ComponentTypeInfo* info) { return info->ID == typeID; });
+
+    auto* target = GetOrCreateArchetype(std::move(types));
+
+    source->SetRemoveEdge(typeID, target);
+    target->SetAddEdge(typeID, source);
+
+    return target;
+}
+
+
+size_t ArchetypeStorage::MoveEntity(EntityIndexType entityIndex, Archetype* target)
+{
+    if (entityIndex >= EntityLocations.size())
+    {
+        EntityLocations.resize(static_cast<size_t>(entityIndex) + 1);
+    }
+
+    auto [source, sourceRow] = EntityLocations[entityIndex];
+
+    const size_t ROW = target->AllocateRow(entityIndex);
+
+    if (source != nullptr)
+    {
+        // 搬运两个原型共有的组件
+        const auto& targetTypes = target->GetTypes();
+
+        for (size_t column = 0; column < targetTypes.size(); ++column)
+        {
+            const size_t SOURCE_COLUMN = source->FindColumn(targetTypes[column]->ID);
+
+            if (SOURCE_COLUMN != Archetype::INVALID_COLUMN)
+            {
+                targetTypes[column]->MoveConstruct(target->GetComponentData(column, ROW),
+                                                   source->GetComponentData(SOURCE_COLUMN, sourceRow));
+            }
+        }
+
+        // 析构原位置上剩余的(已被移走的)组件
+        RemoveRow(source, sourceRow);
+    }
+
+    EntityLocations[entityIndex] = EntityLocation{.Owner = target, .Row = ROW};
+
+    return ROW;
+}
+
+
+void ArchetypeStorage::RemoveRow(Archetype* owner, size_t row)
+{
+    EntityIndexType movedEntity{};
+
+    if (owner->RemoveRow(row, movedEntity))
+    {
+        EntityLocations[movedEntity].Row = row;
+    }
+}
+
+} // namespace NekiraECS
@@ -0,0 +1,347 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#include <Command/CommandBuffer.hpp>
+#include <World/World.hpp>
+#include <algorithm>
+
+
+namespace NekiraECS
+{
+
+namespace
+{
+// 为每个CommandBuffer分配唯一的ID，0保留给未命中的线程本地缓存
+std::atomic<uint64_t> NextBufferID{1};
+
+// 将offset向上对齐到alignment
+size_t AlignUp(size_t offset, size_t alignment)
+{
+    return (offset + alignment - 1) / alignment * alignment;
+}
+} // namespace
+
+
+CommandBuffer::CommandBuffer() : BufferID(NextBufferID.fetch_add(1, std::memory_order_relaxed))
+{}
+
+
+CommandBuffer::~CommandBuffer()
+{
+    Clear();
+
+    for (const auto& [threadID, stream] : Streams)
+    {
+        FreeBlocks(*stream);
+    }
+}
+
+
+Entity CommandBuffer::CreateEntity()
+{
+    // 延迟实体的索引从1开始，版本号为0，因此既不是无效实体，也不会与任何真实实体相同
+    const size_t INDEX = DeferredCount.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    if (INDEX > ENTITY_INDEX_MAX)
+    {
+        return {};
+    }
+
+    Entity entity(static_cast<EntityIDType>(INDEX) << ENTITY_INDEX_SHIFT);
+
+    AllocateCommand(CommandType::CreateEntity, entity, nullptr, 0, 1);
+
+    return entity;
+}
+
+
+void CommandBuffer::DestroyEntity(const Entity& entity)
+{
+    AllocateCommand(CommandType::DestroyEntity, entity, nullptr, 0, 1);
+}
+
+
+void CommandBuffer::Playback(World& world)
+{
+    if (IsEmpty())
+    {
+        return;
+    }
+
+    auto& entityManager = world.GetEntityManager();
+    auto& componentManager = world.GetComponentManager();
+
+    /**
+     * 取走所有命令流并更换BufferID，使线程本地缓存失效。
+     * 回放会同步触发组件观察者，观察者记录的命令写入新的命令流，留到下一次回放，而不会在重置时丢失
+     */
+    std::unordered_map<std::thread::id, std::unique_ptr<CommandStream>> streams;
+    std::vector<CommandStream*>                                         streamOrder;
+    size_t                                                              deferredCount = 0;
+
+    {
+        std::lock_guard lock(StreamMutex);
+
+        streams.swap(Streams);
+        streamOrder.swap(StreamOrder);
+
+        BufferID = NextBufferID.fetch_add(1, std::memory_order_relaxed);
+        deferredCount = DeferredCount.exchange(0, std::memory_order_relaxed);
+        CommandCount.store(0, std::memory_order_release);
+    }
+
+    // 延迟实体索引 -> 真实实体
+    std::vector<Entity> createdEntities(deferredCount + 1);
+
+    std::vector<CommandHeader*> componentCommands;
+    std::vector<CommandHeader*> destroyCommands;
+
+    // 1.创建实体，同时按类别收集其余命令
+    ForEachCommand(
+        streamOrder,
+        [&](CommandHeader* header)
+        {
+            switch (header->Type)
+            {
+            case CommandType::CreateEntity:
+                createdEntities[EntityManager::GetEntityIndex(header->Target)] = entityManager.CreateEntity();
+                break;
+            case CommandType::DestroyEntity:
+                destroyCommands.push_back(header);
+                break;
+            default:
+                componentCommands.push_back(header);
+                break;
+            }
+        });
+
+    const auto RESOLVE = [&createdEntities](EntityIDType target)
+    {
+        const Entity ENTITY(target);
+
+        if (!IsDeferred(ENTITY))
+        {
+            return ENTITY;
+        }
+
+        const EntityIndexType INDEX = EntityManager::GetEntityIndex(target);
+
+        return INDEX < createdEntities.size() ? createdEntities[INDEX] : Entity();
+    };
+
+    // 2.按组件类型分批执行组件命令
+    std::ranges::stable_sort(componentCommands, {}, [](const CommandHeader* header) { return header->Info->ID; });
+
+    for (auto* header : componentCommands)
+    {
+        const Entity TARGET = RESOLVE(header->Target);
+        void*        payload = reinterpret_cast<std::byte*>(header) + header->PayloadOffset;
+
+        if (entityManager.IsValid(TARGET))
+        {
+            const EntityIndexType ENTITY_INDEX = EntityManager::GetEntityIndex(TARGET);
+
+            if (header->Type == CommandType::AddComponent)
+            {
+                header->Info->Add(componentManager, payload, ENTITY_INDEX);
+            }
+            else
+            {
+                header->Info->Remove(componentManager, ENTITY_INDEX);
+            }
+        }
+
+        if (header->Type == CommandType::AddComponent)
+        {
+            header->Info->Destroy(payload);
+        }
+    }
+
+    // 3.销毁实体
+    for (const auto* header : destroyCommands)
+    {
+        const Entity TARGET = RESOLVE(header->Target);
+
+        if (entityManager.IsValid(TARGET))
+        {
+            componentManager.RemoveEntityAllComponents(EntityManager::GetEntityIndex(TARGET));
+            entityManager.DestroyEntity(TARGET);
+        }
+    }
+
+    ReturnStreams(streams, streamOrder);
+}
+
+
+void CommandBuffer::Clear()
+{
+    ForEachCommand(
+        StreamOrder,
+        [](CommandHeader* header)
+        {
+            if (header->Type == CommandType::AddComponent)
+            {
+                header->Info->Destroy(reinterpret_cast<std::byte*>(header) + header->PayloadOffset);
+            }
+        });
+
+    ResetStreams();
+}
+
+
+bool CommandBuffer::IsEmpty() const
+{
+    return CommandCount.load(std::memory_order_acquire) == 0;
+}
+
+
+bool CommandBuffer::IsDeferred(const Entity& entity)
+{
+    return entity.ID != INVALID_ENTITYID && EntityManager::GetEntityVersion(entity) == 0;
+}
+
+
+void* CommandBuffer::AllocateCommand(CommandType type, const Entity& target, const ComponentCommandInfo* info,
+                                     size_t payloadSize, size_t payloadAlign)
+{
+    auto& stream = GetLocalStream();
+
+    // 计算命令在内存块中的布局，内存块按BLOCK_ALIGNMENT对齐，因此块内偏移对齐即地址对齐
+    size_t payloadOffset = 0;
+    size_t end = 0;
+
+    const auto FITS = [&](const CommandBlock& block)
+    {
+        payloadOffset = AlignUp(block.Used + sizeof(CommandHeader), payloadAlign);
+        end = AlignUp(payloadOffset + payloadSize, alignof(CommandHeader));
+
+        return end <= block.Capacity;
+    };
+
+    while (stream.Current < stream.Blocks.size() && !FITS(stream.Blocks[stream.Current]))
+    {
+        ++stream.Current;
+    }
+
+    // 没有可用的内存块，分配新的内存块。超大的组件独占一个足够大的内存块
+    if (stream.Current == stream.Blocks.size())
+    {
+        const size_t CAPACITY = std::max(BLOCK_SIZE, AlignUp(sizeof(CommandHeader) + payloadAlign + payloadSize,
+                                                             BLOCK_ALIGNMENT));
+
+        stream.Blocks.push_back(CommandBlock{
+            .Data = static_cast<std::byte*>(::operator new(CAPACITY, std::align_val_t{BLOCK_ALIGNMENT})),
+            .Capacity = CAPACITY,
+            .Used = 0});
+
+        FITS(stream.Blocks.back());
+    }
+
+    auto& block = stream.Blocks[stream.Current];
+
+    ::new (block.Data + block.Used) CommandHeader{.Info = info,
+                                                  .Target = target.ID,
+                                                  .PayloadOffset = static_cast<uint32_t>(payloadOffset - block.Used),
+                                                  .Size = static_cast<uint32_t>(end - block.Used),
+                                                  .Type = type};
+
+    block.Used = end;
+
+    CommandCount.fetch_add(1, std::memory_order_release);
+
+    return block.Data + payloadOffset;
+}
+
+
+CommandBuffer::CommandStream& CommandBuffer::GetLocalStream()
+{
+    // 线程本地缓存最近一次使用的命令流，命中时无需加锁
+    thread_local uint64_t       cachedBufferID = 0;
+    thread_local CommandStream* cachedStream = nullptr;
+
+    if (cachedBufferID == BufferID)
+    {
+        return *cachedStream;
+    }
+
+    std::lock_guard lock(StreamMutex);
+
+    auto& stream = Streams[std::this_thread::get_id()];
+
+    if (stream == nullptr)
+    {
+        stream = std::make_unique<CommandStream>();
+        stream->Owner = std::this_thread::get_id();
+        StreamOrder.push_back(stream.get());
+    }
+
+    cachedBufferID = BufferID;
+    cachedStream = stream.get();
+
+    return *stream;
+}
+
+
+void CommandBuffer::ResetStreams()
+{
+    for (auto* stream : StreamOrder)
+    {
+        for (auto& block : stream->Blocks)
+        {
+            block.Used = 0;
+        }
+
+        stream->Current = 0;
+    }
+
+    DeferredCount.store(0, std::memory_order_relaxed);
+    CommandCount.store(0, std::memory_order_release);
+}
+
+
+void CommandBuffer::ReturnStreams(std::unordered_map<std::thread::id, std::unique_ptr<CommandStream>>& streams,
+                                  const std::vector<CommandStream*>&                                   order)
+{
+    std::lock_guard lock(StreamMutex);
+
+    for (auto* stream : order)
+    {
+        for (auto& block : stream->Blocks)
+        {
+            block.Used = 0;
+        }
+
+        stream->Current = 0;
+
+        auto& owned = streams[stream->Owner];
+
+        // 该线程在回放期间已创建了新的命令流
+        if (Streams.contains(stream->Owner))
+        {
+            FreeBlocks(*stream);
+            continue;
+        }
+
+        StreamOrder.push_back(stream);
+        Streams.emplace(stream->Owner, std::move(owned));
+    }
+}
+
+
+void CommandBuffer::FreeBlocks(CommandStream& stream)
+{
+    for (const auto& block : stream.Blocks)
+    {
+        ::operator delete(block.Data, std::align_val_t{BLOCK_ALIGNMENT});
+    }
+
+    stream.Blocks.clear();
+    stream.Current = 0;
+}
+
+} // namespace NekiraECS
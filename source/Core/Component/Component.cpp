@@ -0,0 +1,34 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#include <Component/Component.hpp>
+#include <atomic>
+
+
+namespace NekiraECS
+{
+
+namespace
+{
+// 下一个可分配的组件类型ID
+std::atomic<ComponentTypeID> NextComponentTypeID{0};
+} // namespace
+
+
+ComponentTypeID ComponentTypeRegistry::NextID()
+{
+    return NextComponentTypeID.fetch_add(1, std::memory_order_relaxed);
+}
+
+
+ComponentTypeID ComponentTypeRegistry::GetCount()
+{
+    return NextComponentTypeID.load(std::memory_order_relaxed);
+}
+
+} // namespace NekiraECS
@@ -7,21 +7,173 @@
  */
 
 #include <Component/ComponentManager.hpp>
+#include <World/World.hpp>
+#include <algorithm>
 
 namespace NekiraECS
 {
 
 ComponentManager& ComponentManager::Get()
 {
-    static ComponentManager instance;
-    return instance;
+    return World::GetDefault().GetComponentManager();
 }
 
+bool ComponentManager::SetStorageMode(ComponentStorageMode mode)
+{
+    if (mode == StorageMode)
+    {
+        return true;
+    }
+
+    const bool HAS_COMPONENTS =
+        std::ranges::any_of(ComponentArrays, [](const auto& handle) { return handle.IsValid() && !handle->IsEmpty(); });
+
+    // 已存储组件时不允许切换，否则已有的组件会丢失
+    if (HAS_COMPONENTS || !Archetypes.IsEmpty())
+    {
+        return false;
+    }
+
+    Groups.clear();
+    ComponentArrays.clear();
+    Archetypes.Clear();
+
+    StorageMode = mode;
+
+    return true;
+}
+
+
+ComponentStorageMode ComponentManager::GetStorageMode() const
+{
+    return StorageMode;
+}
+
+
+ArchetypeStorage& ComponentManager::GetArchetypeStorage()
+{
+    return Archetypes;
+}
+
+ComponentManagerMemoryUsage ComponentManager::GetMemoryUsage() const
+{
+    ComponentManagerMemoryUsage usage;
+
+    for (const auto& handle : ComponentArrays)
+    {
+        if (!handle.IsValid())
+        {
+            continue;
+        }
+
+        auto type = handle->GetMemoryUsage();
+
+        usage.Count += type.Count;
+        usage.DenseBytes += type.DenseBytes;
+        usage.SlackBytes += type.SlackBytes;
+        usage.SparseIndexBytes += type.SparseIndexBytes;
+        usage.TrackingBytes += type.TrackingBytes;
+
+        usage.Types.push_back(std::move(type));
+    }
+
+    usage.ArrayTableBytes = ComponentArrays.capacity() * sizeof(ComponentArrayHandle);
+    usage.ArchetypeChunkBytes = Archetypes.GetChunkMemoryBytes();
+
+    return usage;
+}
+
+void ComponentManager::FlushComponentEvents()
+{
+    // 批量观察者可能会添加新的组件类型，因此按下标遍历
+    for (size_t typeID = 0; typeID < ComponentArrays.size(); ++typeID)
+    {
+        if (ComponentArrays[typeID].IsValid() && ComponentArrays[typeID]->GetObservers() != nullptr)
+        {
+            ComponentArrays[typeID]->GetObservers()->Flush();
+        }
+    }
+}
+
+
+ComponentTick ComponentManager::GetCurrentTick() const
+{
+    return CurrentTick;
+}
+
+
+void ComponentManager::AdvanceTick()
+{
+    ++CurrentTick;
+
+    // 同步点：裁剪变化日志，并压缩空闲槽位过多的稳定地址存储
+    for (auto& compArray : ComponentArrays)
+    {
+        if (!compArray.IsValid())
+        {
+            continue;
+        }
+
+        if (compArray->GetTracker() != nullptr)
+        {
+            compArray->GetTracker()->Trim(compArray->Size());
+        }
+
+        compArray->CompactIfFragmented();
+    }
+}
+
+
 void ComponentManager::RemoveEntityAllComponents(EntityIndexType entityIndex)
 {
-    for (auto& [compType, compArray] : ComponentArrays)
+    if (StorageMode == ComponentStorageMode::Archetype)
+    {
+        Archetypes.RemoveEntityAllComponents(entityIndex);
+        return;
+    }
+
+    for (auto& compArray : ComponentArrays)
+    {
+        if (compArray.IsValid())
+        {
+            compArray->RemoveComponent(entityIndex);
+        }
+    }
+}
+
+void ComponentManager::DestroyGroup(const IComponentGroupBase* group)
+{
+    if (group == nullptr)
     {
-        compArray->RemoveComponent(entityIndex);
+        return;
+    }
+
+    std::erase_if(Groups, [group](const GroupEntry& entry) { return entry.Group.get() == group; });
+}
+
+
+void ComponentManager::RemoveEntitiesAllComponents(std::span<const EntityIndexType> entityIndices)
+{
+    if (StorageMode == ComponentStorageMode::Archetype)
+    {
+        for (const auto ENTITY_INDEX : entityIndices)
+        {
+            Archetypes.RemoveEntityAllComponents(ENTITY_INDEX);
+        }
+        return;
+    }
+
+    for (auto& compArray : ComponentArrays)
+    {
+        if (!compArray.IsValid() || compArray->IsEmpty())
+        {
+            continue;
+        }
+
+        for (const auto ENTITY_INDEX : entityIndices)
+        {
+            compArray->RemoveComponent(ENTITY_INDEX);
+        }
     }
 }
 } // namespace NekiraECS
\ No newline at end of file
@@ -0,0 +1,78 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#include <Component/ComponentObserver.hpp>
+#include <algorithm>
+#include <utility>
+
+namespace NekiraECS
+{
+
+ComponentObservers::ComponentObservers(const EntityManager* entityManager) : Entities(entityManager)
+{}
+
+
+ComponentObserverID ComponentObservers::AddImmediate(ImmediateListener listener)
+{
+    const ComponentObserverID ID = NextID++;
+
+    ImmediateEntries.push_back(ImmediateEntry{.ID = ID, .Listener = std::move(listener)});
+
+    return ID;
+}
+
+
+ComponentObserverID ComponentObservers::AddBatched(BatchedListener listener)
+{
+    const ComponentObserverID ID = NextID++;
+
+    BatchedEntries.push_back(BatchedEntry{.ID = ID, .Listener = std::move(listener)});
+
+    return ID;
+}
+
+
+bool ComponentObservers::Remove(ComponentObserverID id)
+{
+    const size_t REMOVED = std::erase_if(ImmediateEntries, [id](const ImmediateEntry& entry) { return entry.ID == id; })
+                           + std::erase_if(BatchedEntries, [id](const BatchedEntry& entry) { return entry.ID == id; });
+
+    // 没有批量监听者时，缓冲中的事件不会再被分发
+    if (BatchedEntries.empty())
+    {
+        Events.clear();
+    }
+
+    return REMOVED > 0;
+}
+
+
+bool ComponentObservers::IsEmpty() const
+{
+    return ImmediateEntries.empty() && BatchedEntries.empty();
+}
+
+
+void ComponentObservers::Flush()
+{
+    if (Events.empty())
+    {
+        return;
+    }
+
+    std::swap(Events, FlushingEvents);
+
+    for (const auto& entry : BatchedEntries)
+    {
+        entry.Listener(FlushingEvents);
+    }
+
+    FlushingEvents.clear();
+}
+
+} // namespace NekiraECS
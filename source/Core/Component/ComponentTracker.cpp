@@ -0,0 +1,108 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#include <Component/ComponentTracker.hpp>
+#include <algorithm>
+#include <cstdint>
+
+namespace NekiraECS
+{
+
+namespace
+{
+// 日志超过limit时丢弃较旧的一半记录，更新保留部分的最早Tick，返回丢弃的记录数量
+template <typename TRecord>
+size_t TrimRecords(std::vector<TRecord>& records, size_t limit, ComponentTick& floor)
+{
+    if (records.size() <= limit)
+    {
+        return 0;
+    }
+
+    // 日志按Tick升序，同一Tick的记录要么全部保留要么全部丢弃
+    const ComponentTick CUTOFF = records[records.size() / 2].Tick;
+
+    auto it = std::ranges::lower_bound(records, CUTOFF, {}, &TRecord::Tick);
+
+    const auto ERASED = static_cast<size_t>(it - records.begin());
+    records.erase(records.begin(), it);
+
+    floor = std::max(floor, CUTOFF);
+
+    return ERASED;
+}
+} // namespace
+
+
+ComponentTracker::ComponentTracker(const ComponentTick* currentTick, const EntityManager* entityManager, size_t size)
+    : CurrentTick(currentTick), Entities(entityManager)
+{
+    // 开启追踪前已存在的组件视为Tick 0，之后的变化都会进入日志，因此日志完整覆盖Tick 1之后的查询
+    for (size_t kind = 0; kind < KIND_COUNT; ++kind)
+    {
+        Ticks[kind].assign(size, 0);
+        LogFloors[kind] = 1;
+
+        // 没有对应记录的序号，日志中的任何记录都不会与它相等
+        Sequences[kind].assign(size, UINT32_MAX);
+    }
+}
+
+
+void ComponentTracker::OnCleared(std::span<const EntityIndexType> entityIndices)
+{
+    for (const auto ENTITY_INDEX : entityIndices)
+    {
+        RecordRemoved(ENTITY_INDEX);
+    }
+
+    for (size_t kind = 0; kind < KIND_COUNT; ++kind)
+    {
+        Ticks[kind].clear();
+        Sequences[kind].clear();
+    }
+}
+
+
+size_t ComponentTracker::GetMemoryBytes() const
+{
+    size_t bytes = Removed.capacity() * sizeof(RemovedRecord);
+
+    for (size_t kind = 0; kind < KIND_COUNT; ++kind)
+    {
+        bytes += Ticks[kind].capacity() * sizeof(ComponentTick);
+        bytes += Sequences[kind].capacity() * sizeof(uint32_t);
+        bytes += Logs[kind].capacity() * sizeof(TickRecord);
+    }
+
+    return bytes;
+}
+
+
+void ComponentTracker::Trim(size_t size)
+{
+    const size_t LIMIT = 2 * std::max(size, MIN_LOG_CAPACITY);
+
+    for (size_t kind = 0; kind < KIND_COUNT; ++kind)
+    {
+        LogBases[kind] += static_cast<uint32_t>(TrimRecords(Logs[kind], LIMIT, LogFloors[kind]));
+    }
+
+    ComponentTick removedFloor = 0;
+    TrimRecords(Removed, LIMIT, removedFloor);
+}
+
+
+void ComponentTracker::RecordRemoved(EntityIndexType entityIndex)
+{
+    const Entity TARGET = Entities != nullptr ? Entities->GetEntity(entityIndex) : Entity();
+
+    Removed.push_back(RemovedRecord{.Target = TARGET, .Tick = *CurrentTick});
+}
+
+} // namespace NekiraECS
@@ -20,44 +20,84 @@ Coordinator& Coordinator::Get()
     return instance;
 }
 
+World& Coordinator::GetWorld()
+{
+    return World::GetDefault();
+}
+
 bool Coordinator::CheckEntity(const Entity& entity)
 {
-    return EntityManager::Get().IsValid(entity);
+    return GetWorld().CheckEntity(entity);
 }
 
 Entity Coordinator::CreateEntity()
 {
-    return EntityManager::Get().CreateEntity();
+    return GetWorld().CreateEntity();
 }
 
 void Coordinator::DestroyEntity(const Entity& entity)
 {
-    if (CheckEntity(entity))
-    {
-        // 移除实体的所有组件
-        ComponentManager::Get().RemoveEntityAllComponents(EntityManager::GetEntityIndex(entity));
-
-        EntityManager::Get().DestroyEntity(entity);
-    }
+    GetWorld().DestroyEntity(entity);
 }
 
 void Coordinator::ForEachEntity(const std::function<void(const Entity&)>& callback)
 {
-    EntityManager::Get().ForEachEntity(callback);
+    GetWorld().ForEachEntity(callback);
+}
+
+WorldMemoryUsage Coordinator::GetMemoryUsage()
+{
+    return GetWorld().GetMemoryUsage();
+}
+
+size_t Coordinator::CreateEntities(size_t count, std::vector<Entity>& outEntities)
+{
+    return GetWorld().CreateEntities(count, outEntities);
+}
+
+void Coordinator::DestroyEntities(std::span<const Entity> entities)
+{
+    GetWorld().DestroyEntities(entities);
 }
 
 void Coordinator::RemoveEntityAllComponents(const Entity& entity)
 {
-    if (CheckEntity(entity))
-    {
-        auto entityIndex = EntityManager::GetEntityIndex(entity);
-        ComponentManager::Get().RemoveEntityAllComponents(entityIndex);
-    }
+    GetWorld().RemoveEntityAllComponents(entity);
+}
+
+bool Coordinator::SetComponentStorageMode(ComponentStorageMode mode)
+{
+    return GetWorld().SetComponentStorageMode(mode);
+}
+
+void Coordinator::FlushComponentEvents()
+{
+    GetWorld().FlushComponentEvents();
+}
+
+ComponentTick Coordinator::GetCurrentTick()
+{
+    return GetWorld().GetCurrentTick();
 }
 
 void Coordinator::UpdateSystems(float deltaTime)
 {
-    SystemManager::Get().Update(deltaTime);
+    GetWorld().UpdateSystems(deltaTime);
+}
+
+void Coordinator::SetSystemWorkerCount(size_t workerCount)
+{
+    GetWorld().SetSystemWorkerCount(workerCount);
+}
+
+CommandBuffer& Coordinator::GetCommandBuffer()
+{
+    return GetWorld().GetCommandBuffer();
+}
+
+SystemProfiler& Coordinator::GetSystemProfiler()
+{
+    return GetWorld().GetSystemProfiler();
 }
 
 } // namespace NekiraECS
\ No newline at end of file
@@ -7,48 +7,61 @@
  */
 
 #include <Entity/Entity.hpp>
+#include <World/World.hpp>
+#include <algorithm>
 
 
 namespace NekiraECS
 {
 
+EntityManager::EntityManager(std::pmr::memory_resource* resource)
+    : EntityVersions(resource), RecycledIDs(RecycledStack::container_type(resource))
+{}
+
 EntityManager& EntityManager::Get()
 {
-    static EntityManager instance;
-    return instance;
+    return World::GetDefault().GetEntityManager();
+}
+
+EntityVersionType EntityManager::NextVersion(EntityVersionType version)
+{
+    // 版本号只占EntityIDLayout::VERSION_BITS位，溢出后回绕。跳过0，避免索引0的实体ID与INVALID_ENTITYID相同
+    auto next = static_cast<EntityVersionType>((static_cast<EntityIDType>(version) + 1) & ENTITY_VERSION_MASK);
+
+    return next == 0 ? 1 : next;
 }
 
 void EntityManager::DecodeEntity(const Entity& entity, EntityIndexType& outIndex, EntityVersionType& outVersion)
 {
     //@[INFO] C++的右移运算符对于无符号整数是逻辑右移，对于有符号整数是算术右移
     // 这里的ID是无符号整数类型，所以右移时高位补0，这保证了右移后仍能得到正确的索引值
-    outIndex = entity.ID >> ENTITY_INDEX_SHIFT;
+    outIndex = static_cast<EntityIndexType>(entity.ID >> ENTITY_INDEX_SHIFT);
 
-    outVersion = entity.ID & ENTITY_VERSION_MASK;
+    outVersion = static_cast<EntityVersionType>(entity.ID & ENTITY_VERSION_MASK);
 }
 
 
 EntityIndexType EntityManager::GetEntityIndex(const Entity& entity)
 {
-    return entity.ID >> ENTITY_INDEX_SHIFT;
+    return static_cast<EntityIndexType>(entity.ID >> ENTITY_INDEX_SHIFT);
 }
 
 
 EntityIndexType EntityManager::GetEntityIndex(EntityIDType entityID)
 {
-    return entityID >> ENTITY_INDEX_SHIFT;
+    return static_cast<EntityIndexType>(entityID >> ENTITY_INDEX_SHIFT);
 }
 
 
 EntityVersionType EntityManager::GetEntityVersion(const Entity& entity)
 {
-    return entity.ID & ENTITY_VERSION_MASK;
+    return static_cast<EntityVersionType>(entity.ID & ENTITY_VERSION_MASK);
 }
 
 
 EntityVersionType EntityManager::GetEntityVersion(EntityIDType entityID)
 {
-    return entityID & ENTITY_VERSION_MASK;
+    return static_cast<EntityVersionType>(entityID & ENTITY_VERSION_MASK);
 }
 
 bool EntityManager::IsValid(const Entity& entity) const
@@ -73,8 +86,8 @@ bool EntityManager::IsValid(EntityIDType entityID) const
         return false;
     }
 
-    EntityIndexType   index = entityID >> ENTITY_INDEX_SHIFT;
-    EntityVersionType version = entityID & ENTITY_VERSION_MASK;
+    EntityIndexType   index = GetEntityIndex(entityID);
+    EntityVersionType version = GetEntityVersion(entityID);
 
     return index < EntityVersions.size() && EntityVersions[index] == version;
 }
@@ -91,6 +104,12 @@ Entity EntityManager::CreateEntity()
     }
     else
     {
+        // 索引已耗尽，返回无效实体
+        if (EntityVersions.size() > ENTITY_INDEX_MAX)
+        {
+            return {};
+        }
+
         // 创建新的实体索引
         auto newIndex = static_cast<EntityIDType>(EntityVersions.size());
 
@@ -107,15 +126,52 @@ Entity EntityManager::CreateEntity()
     return Entity(id);
 }
 
+size_t EntityManager::CreateEntities(size_t count, std::vector<Entity>& outEntities)
+{
+    outEntities.reserve(outEntities.size() + count);
+
+    size_t created = 0;
+
+    // 优先使用回收的ID
+    while (created < count && !RecycledIDs.empty())
+    {
+        outEntities.push_back(Entity(RecycledIDs.top()));
+        RecycledIDs.pop();
+        ++created;
+    }
+
+    // 剩余的实体一次性扩展版本号数组，新版本号从1开始
+    const size_t OLD_SIZE = EntityVersions.size();
+    const size_t AVAILABLE = OLD_SIZE > ENTITY_INDEX_MAX ? 0 : static_cast<size_t>(ENTITY_INDEX_MAX) + 1 - OLD_SIZE;
+    const size_t NEW_COUNT = std::min(count - created, AVAILABLE);
+
+    EntityVersions.resize(OLD_SIZE + NEW_COUNT, 1);
+
+    for (size_t index = OLD_SIZE; index < OLD_SIZE + NEW_COUNT; ++index)
+    {
+        outEntities.push_back(Entity((static_cast<EntityIDType>(index) << ENTITY_INDEX_SHIFT) | 1));
+    }
+
+    return created + NEW_COUNT;
+}
+
+void EntityManager::DestroyEntities(std::span<const Entity> entities)
+{
+    for (const auto& entity : entities)
+    {
+        DestroyEntity(entity);
+    }
+}
+
 void EntityManager::DestroyEntity(const Entity& entity)
 {
-    EntityIndexType   index = entity.ID >> ENTITY_INDEX_SHIFT;
-    EntityVersionType version = entity.ID & ENTITY_VERSION_MASK;
+    EntityIndexType   index = GetEntityIndex(entity);
+    EntityVersionType version = GetEntityVersion(entity);
 
     if (IsValid(entity.ID))
     {
         // 叠加版本号，使原先ID失效
-        version += 1;
+        version = NextVersion(version);
         EntityVersions[index] = version;
 
         // 组合新的ID并回收
@@ -159,4 +215,17 @@ void EntityManager::ForEachEntity(const std::function<void(const Entity&)>& call
         }
     }
 }
+
+EntityMemoryUsage EntityManager::GetMemoryUsage() const
+{
+    return EntityMemoryUsage{.IndexCount = EntityVersions.size(),
+                             .AliveCount = EntityVersions.size() - RecycledIDs.size(),
+                             .VersionBytes = EntityVersions.capacity() * sizeof(EntityVersionType),
+                             .RecycledBytes = RecycledIDs.size() * sizeof(EntityIDType)};
+}
+
+std::pmr::memory_resource* EntityManager::GetMemoryResource() const
+{
+    return EntityVersions.get_allocator().resource();
+}
 }; // namespace NekiraECS
\ No newline at end of file
@@ -0,0 +1,83 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#include <Memory/MemoryUsage.hpp>
+
+
+namespace NekiraECS
+{
+
+namespace
+{
+// 输出JSON字符串。类型名不含控制字符，只需转义引号与反斜杠
+void WriteJsonString(std::ostream& stream, const std::string& text)
+{
+    stream << '"';
+
+    for (const char CHAR : text)
+    {
+        if (CHAR == '"' || CHAR == '\\')
+        {
+            stream << '\\';
+        }
+
+        stream << CHAR;
+    }
+
+    stream << '"';
+}
+} // namespace
+
+
+void ComponentMemoryUsage::WriteJson(std::ostream& stream) const
+{
+    stream << "{\"type_id\": " << TypeID << ", \"name\": ";
+    WriteJsonString(stream, Name);
+    stream << ", \"component_size\": " << ComponentSize << ", \"count\": " << Count << ", \"capacity\": " << Capacity
+           << ", \"dense_bytes\": " << DenseBytes << ", \"slack_bytes\": " << SlackBytes
+           << ", \"sparse_index_bytes\": " << SparseIndexBytes << ", \"sparse_index_pages\": " << SparseIndexPages
+           << ", \"occupancy_ratio\": " << OccupancyRatio << ", \"tracking_bytes\": " << TrackingBytes
+           << ", \"peak_bytes\": " << PeakBytes << ", \"total_bytes\": " << GetTotalBytes() << "}";
+}
+
+
+void ComponentManagerMemoryUsage::WriteJson(std::ostream& stream) const
+{
+    stream << "{\"count\": " << Count << ", \"dense_bytes\": " << DenseBytes << ", \"slack_bytes\": " << SlackBytes
+           << ", \"sparse_index_bytes\": " << SparseIndexBytes << ", \"tracking_bytes\": " << TrackingBytes
+           << ", \"array_table_bytes\": " << ArrayTableBytes << ", \"archetype_chunk_bytes\": " << ArchetypeChunkBytes
+           << ", \"total_bytes\": " << GetTotalBytes() << ", \"types\": [";
+
+    for (size_t index = 0; index < Types.size(); ++index)
+    {
+        stream << (index == 0 ? "" : ", ");
+        Types[index].WriteJson(stream);
+    }
+
+    stream << "]}";
+}
+
+
+void EntityMemoryUsage::WriteJson(std::ostream& stream) const
+{
+    stream << "{\"index_count\": " << IndexCount << ", \"alive_count\": " << AliveCount
+           << ", \"version_bytes\": " << VersionBytes << ", \"recycled_bytes\": " << RecycledBytes
+           << ", \"total_bytes\": " << GetTotalBytes() << "}";
+}
+
+
+void WorldMemoryUsage::WriteJson(std::ostream& stream) const
+{
+    stream << "{\"total_bytes\": " << GetTotalBytes() << ", \"entities\": ";
+    Entities.WriteJson(stream);
+    stream << ", \"components\": ";
+    Components.WriteJson(stream);
+    stream << "}";
+}
+
+} // namespace NekiraECS
@@ -0,0 +1,857 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#include <Profiler/SystemProfiler.hpp>
+#include <System/System.hpp>
+#include <algorithm>
+#include <iomanip>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+
+namespace NekiraECS
+{
+
+namespace
+{
+// 各系统分组的区间名，顺序与SystemGroup一致
+constexpr std::array<const char*, 6> GROUP_SCOPE_NAMES = {"BeginFrame",   "PreUpdate", "Update", "PostUpdate",
+                                                          "Presentation", "EndFrame"};
+
+// 线程槽位池，线程退出后槽位可被新线程复用
+struct ThreadSlotPool final
+{
+    std::mutex Mutex;
+
+    std::vector<uint32_t> FreeSlots;
+
+    uint32_t NextSlot = 0;
+};
+
+ThreadSlotPool& GetThreadSlotPool()
+{
+    static ThreadSlotPool pool;
+    return pool;
+}
+
+// 线程在第一次记录时获取槽位，退出时归还
+struct ThreadSlot final
+{
+    ThreadSlot()
+    {
+        auto&                             pool = GetThreadSlotPool();
+        const std::lock_guard<std::mutex> LOCK(pool.Mutex);
+
+        if (pool.FreeSlots.empty())
+        {
+            Index = pool.NextSlot++;
+        }
+        else
+        {
+            Index = pool.FreeSlots.back();
+            pool.FreeSlots.pop_back();
+        }
+    }
+
+    ~ThreadSlot()
+    {
+        auto&                             pool = GetThreadSlotPool();
+        const std::lock_guard<std::mutex> LOCK(pool.Mutex);
+
+        pool.FreeSlots.push_back(Index);
+    }
+
+    ThreadSlot(const ThreadSlot&) = delete;
+    ThreadSlot(ThreadSlot&&) noexcept = delete;
+
+    ThreadSlot& operator=(const ThreadSlot&) = delete;
+    ThreadSlot& operator=(ThreadSlot&&) noexcept = delete;
+
+    uint32_t Index = 0;
+};
+
+uint32_t GetThreadSlotIndex()
+{
+    thread_local ThreadSlot slot;
+    return slot.Index;
+}
+
+const char* GetKindName(ProfileScopeKind kind)
+{
+    switch (kind)
+    {
+        case ProfileScopeKind::Frame:
+            return "Frame";
+        case ProfileScopeKind::SystemGroup:
+            return "SystemGroup";
+        case ProfileScopeKind::System:
+            return "System";
+    }
+
+    return "Unknown";
+}
+
+// 输出JSON字符串，转义引号、反斜杠与控制字符
+void WriteJsonString(std::ostream& stream, const std::string& text)
+{
+    stream << '"';
+
+    for (const char CHAR : text)
+    {
+        if (CHAR == '"' || CHAR == '\\')
+        {
+            stream << '\\' << CHAR;
+        }
+        else if (static_cast<unsigned char>(CHAR) < 0x20)
+        {
+            stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(CHAR) << std::dec
+                   << std::setfill(' ');
+        }
+        else
+        {
+            stream << CHAR;
+        }
+    }
+
+    stream << '"';
+}
+
+// 以微秒输出纳秒数，保留3位小数
+void WriteMicroseconds(std::ostream& stream, uint64_t nanoseconds)
+{
+    stream << nanoseconds / 1000 << '.' << std::setw(3) << std::setfill('0') << nanoseconds % 1000
+           << std::setfill(' ');
+}
+
+/**
+ * 只有一个写入线程的环形缓冲，每个事件由N个uint64_t组成
+ *
+ * @[INFO] 并发读取逻辑：
+ *
+ * 1.写入第i个事件前先将Claimed设为i+1，写入后将Published设为i+1。
+ * 2.读取方先读Published，读取事件后再读Claimed，序号小于Claimed-BUFFER_CAPACITY的事件可能已被覆盖，需要丢弃。
+ */
+template <size_t N>
+struct EventRing final
+{
+    using Values = std::array<uint64_t, N>;
+
+    static constexpr uint64_t CAPACITY = SystemProfiler::BUFFER_CAPACITY;
+    static constexpr uint64_t MASK = CAPACITY - 1;
+
+    static_assert((CAPACITY & MASK) == 0, "BUFFER_CAPACITY must be a power of two");
+
+    void Push(const Values& values)
+    {
+        const uint64_t INDEX = Published.load(std::memory_order_relaxed);
+
+        Claimed.store(INDEX + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        auto& event = Events[INDEX & MASK];
+        for (size_t index = 0; index < N; ++index)
+        {
+            event[index].store(values[index], std::memory_order_relaxed);
+        }
+
+        Published.store(INDEX + 1, std::memory_order_release);
+    }
+
+    // 将未被覆盖的事件按写入顺序追加到out
+    void Read(std::vector<Values>& out) const
+    {
+        const uint64_t PUBLISHED = Published.load(std::memory_order_acquire);
+        const uint64_t BEGIN = PUBLISHED > CAPACITY ? PUBLISHED - CAPACITY : 0;
+        const size_t   OFFSET = out.size();
+
+        for (uint64_t index = BEGIN; index < PUBLISHED; ++index)
+        {
+            const auto& event = Events[index & MASK];
+
+            Values values;
+            for (size_t value = 0; value < N; ++value)
+            {
+                values[value] = event[value].load(std::memory_order_relaxed);
+            }
+
+            out.push_back(values);
+        }
+
+        // 读取期间被覆盖的事件不可信
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        const uint64_t CLAIMED = Claimed.load(std::memory_order_relaxed);
+        const uint64_t VALID = std::max(BEGIN, CLAIMED > CAPACITY ? CLAIMED - CAPACITY : 0);
+
+        out.erase(out.begin() + static_cast<ptrdiff_t>(OFFSET),
+                  out.begin() + static_cast<ptrdiff_t>(OFFSET + std::min(VALID, PUBLISHED) - BEGIN));
+    }
+
+    std::array<std::array<std::atomic<uint64_t>, N>, CAPACITY> Events;
+
+    std::atomic<uint64_t> Claimed{0};
+
+    std::atomic<uint64_t> Published{0};
+};
+
+// 一次硬件计数器读数
+struct CounterReading final
+{
+    std::array<uint64_t, HARDWARE_COUNTER_COUNT> Values{};
+
+    // 计数器组启用与实际运行的时间，二者不同说明计数器被复用
+    uint64_t TimeEnabled = 0;
+    uint64_t TimeRunning = 0;
+};
+
+#if defined(__linux__)
+struct CounterConfig final
+{
+    uint32_t Type;
+    uint64_t Config;
+};
+
+constexpr uint64_t MakeCacheMissConfig(uint64_t cache)
+{
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+// 各计数器的perf_event配置，顺序与HardwareCounter一致
+constexpr std::array<CounterConfig, HARDWARE_COUNTER_COUNT> COUNTER_CONFIGS = {{
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HW_CACHE, MakeCacheMissConfig(PERF_COUNT_HW_CACHE_L1D)},
+    {PERF_TYPE_HW_CACHE, MakeCacheMissConfig(PERF_COUNT_HW_CACHE_LL)},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+}};
+
+/**
+ * 当前线程的perf_event计数器组，第一次使用时打开，线程退出时关闭
+ *
+ * @[INFO] 打开逻辑：
+ *
+ * 1.cycles作为组长，打开失败则整组不可用。
+ * 2.其余计数器加入该组，单个打开失败时只是不可用，不影响其他计数器。
+ * 3.一次read读取整组的值，以及组启用与实际运行的时间，用于按复用比例缩放。
+ */
+class HardwareCounterGroup final
+{
+public:
+    HardwareCounterGroup()
+    {
+        Fds.fill(-1);
+
+        for (size_t counter = 0; counter < HARDWARE_COUNTER_COUNT; ++counter)
+        {
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = COUNTER_CONFIGS[counter].Type;
+            attr.config = COUNTER_CONFIGS[counter].Config;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            // pid为0、cpu为-1表示只统计调用线程
+            const auto FD =
+                static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, Fds[0], PERF_FLAG_FD_CLOEXEC));
+
+            if (FD < 0)
+            {
+                if (counter == 0)
+                {
+                    return;
+                }
+
+                continue;
+            }
+
+            Fds[counter] = FD;
+            Positions[counter] = OpenedCount++;
+            Mask |= 1U << counter;
+        }
+    }
+
+    ~HardwareCounterGroup()
+    {
+        for (const int FD : Fds)
+        {
+            if (FD >= 0)
+            {
+                close(FD);
+            }
+        }
+    }
+
+    HardwareCounterGroup(const HardwareCounterGroup&) = delete;
+    HardwareCounterGroup(HardwareCounterGroup&&) noexcept = delete;
+
+    HardwareCounterGroup& operator=(const HardwareCounterGroup&) = delete;
+    HardwareCounterGroup& operator=(HardwareCounterGroup&&) noexcept = delete;
+
+    [[nodiscard]] bool IsAvailable() const
+    {
+        return Fds[0] >= 0;
+    }
+
+    [[nodiscard]] uint32_t GetMask() const
+    {
+        return Mask;
+    }
+
+    bool Read(CounterReading& reading) const
+    {
+        // 格式：数量、启用时间、运行时间、各计数器的值
+        std::array<uint64_t, 3 + HARDWARE_COUNTER_COUNT> data{};
+
+        const auto EXPECTED = static_cast<ssize_t>((3 + OpenedCount) * sizeof(uint64_t));
+
+        if (!IsAvailable() || read(Fds[0], data.data(), sizeof(data)) < EXPECTED)
+        {
+            return false;
+        }
+
+        reading.TimeEnabled = data[1];
+        reading.TimeRunning = data[2];
+
+        for (size_t counter = 0; counter < HARDWARE_COUNTER_COUNT; ++counter)
+        {
+            reading.Values[counter] = (Mask & (1U << counter)) != 0 ? data[3 + Positions[counter]] : 0;
+        }
+
+        return true;
+    }
+
+    // 采样开始时的读数
+    CounterReading Begin;
+
+    // 是否有未结束的采样
+    bool IsSampling = false;
+
+private:
+    std::array<int, HARDWARE_COUNTER_COUNT> Fds{};
+
+    // 计数器在组读数中的位置
+    std::array<uint32_t, HARDWARE_COUNTER_COUNT> Positions{};
+
+    uint32_t OpenedCount = 0;
+
+    uint32_t Mask = 0;
+};
+
+HardwareCounterGroup& GetHardwareCounterGroup()
+{
+    thread_local HardwareCounterGroup group;
+    return group;
+}
+#endif
+
+// Info的低32位为帧序号，判断是否在最近window帧内
+bool IsInFrameWindow(uint64_t info, uint32_t currentFrame, uint64_t window)
+{
+    return static_cast<uint32_t>(currentFrame - static_cast<uint32_t>(info & UINT32_MAX)) < window;
+}
+} // namespace
+
+
+struct SystemProfiler::ThreadBuffer final
+{
+    ~ThreadBuffer()
+    {
+        delete Counters.load(std::memory_order_acquire);
+    }
+
+    // 区间事件：开始时间、结束时间、Info(高32位为区间ID，低32位为帧序号)
+    EventRing<3> Timings;
+
+    // 硬件计数器事件：Info、实体数量、可用计数器掩码、各计数器的值。开启硬件计数器后由写入线程创建
+    std::atomic<EventRing<3 + HARDWARE_COUNTER_COUNT>*> Counters{nullptr};
+};
+
+
+SystemProfiler::SystemProfiler()
+{
+    FrameScope = RegisterScope("Frame", ProfileScopeKind::Frame);
+
+    FirstGroupScope = static_cast<ProfileScopeID>(Scopes.size());
+    for (const char* name : GROUP_SCOPE_NAMES)
+    {
+        RegisterScope(name, ProfileScopeKind::SystemGroup);
+    }
+}
+
+
+SystemProfiler::~SystemProfiler()
+{
+    for (auto& buffer : Buffers)
+    {
+        delete buffer.load(std::memory_order_acquire);
+    }
+}
+
+
+void SystemProfiler::SetEnabled(bool enabled)
+{
+    Enabled.store(enabled, std::memory_order_relaxed);
+}
+
+
+ProfileScopeID SystemProfiler::RegisterScope(const std::string& name, ProfileScopeKind kind)
+{
+    const std::lock_guard<std::mutex> LOCK(ScopeMutex);
+
+    const auto IT = std::ranges::find_if(Scopes, [&name, kind](const ScopeInfo& scope)
+                                         { return scope.Kind == kind && scope.Name == name; });
+
+    if (IT != Scopes.end())
+    {
+        return static_cast<ProfileScopeID>(IT - Scopes.begin());
+    }
+
+    Scopes.push_back(ScopeInfo{.Name = name, .Kind = kind});
+
+    return static_cast<ProfileScopeID>(Scopes.size() - 1);
+}
+
+
+ProfileScopeID SystemProfiler::GetFrameScope() const
+{
+    return FrameScope;
+}
+
+
+ProfileScopeID SystemProfiler::GetGroupScope(SystemGroup group) const
+{
+    return FirstGroupScope + static_cast<ProfileScopeID>(group);
+}
+
+
+void SystemProfiler::BeginFrame()
+{
+    FrameIndex.fetch_add(1, std::memory_order_relaxed);
+}
+
+
+uint64_t SystemProfiler::GetFrameIndex() const
+{
+    return FrameIndex.load(std::memory_order_relaxed);
+}
+
+
+void SystemProfiler::Record(ProfileScopeID scope, uint64_t startNanoseconds, uint64_t endNanoseconds)
+{
+    if (!IsEnabled() || scope == INVALID_PROFILE_SCOPE_ID)
+    {
+        return;
+    }
+
+    ThreadBuffer* buffer = GetThreadBuffer();
+
+    if (buffer == nullptr)
+    {
+        Dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    const uint64_t FRAME = FrameIndex.load(std::memory_order_relaxed) & UINT32_MAX;
+
+    buffer->Timings.Push({startNanoseconds, endNanoseconds, (static_cast<uint64_t>(scope) << 32) | FRAME});
+}
+
+
+SystemProfiler::ThreadBuffer* SystemProfiler::GetThreadBuffer()
+{
+    const uint32_t SLOT = GetThreadSlotIndex();
+
+    if (SLOT >= MAX_THREADS)
+    {
+        return nullptr;
+    }
+
+    auto&         entry = Buffers[SLOT];
+    ThreadBuffer* buffer = entry.load(std::memory_order_acquire);
+
+    if (buffer != nullptr)
+    {
+        return buffer;
+    }
+
+    // 槽位同一时刻只属于一个线程，但仍用CAS保证不会重复创建
+    auto* created = new ThreadBuffer();
+
+    if (entry.compare_exchange_strong(buffer, created, std::memory_order_acq_rel))
+    {
+        return created;
+    }
+
+    delete created;
+    return buffer;
+}
+
+
+std::vector<SystemProfiler::EventRecord> SystemProfiler::CollectEvents(size_t frameCount) const
+{
+    std::vector<EventRecord> events;
+
+    const auto     CURRENT = static_cast<uint32_t>(FrameIndex.load(std::memory_order_acquire));
+    const uint64_t WINDOW = std::min<uint64_t>(frameCount, UINT32_MAX);
+
+    std::vector<EventRing<3>::Values> raw;
+
+    for (uint32_t slot = 0; slot < MAX_THREADS; ++slot)
+    {
+        const ThreadBuffer* buffer = Buffers[slot].load(std::memory_order_acquire);
+
+        if (buffer == nullptr)
+        {
+            continue;
+        }
+
+        raw.clear();
+        buffer->Timings.Read(raw);
+
+        for (const auto& [start, end, info] : raw)
+        {
+            if (!IsInFrameWindow(info, CURRENT, WINDOW))
+            {
+                continue;
+            }
+
+            events.push_back(EventRecord{.Start = start,
+                                         .End = std::max(start, end),
+                                         .Scope = static_cast<ProfileScopeID>(info >> 32),
+                                         .Thread = slot});
+        }
+    }
+
+    return events;
+}
+
+
+std::vector<ProfileScopeStats> SystemProfiler::CollectStats(size_t frameCount) const
+{
+    const auto EVENTS = CollectEvents(frameCount);
+
+    const auto SCOPES = CopyScopes();
+
+    // 每个区间的耗时，以及最近一次记录的开始时间
+    std::vector<std::vector<uint64_t>> durations(SCOPES.size());
+    std::vector<uint64_t>              lastStarts(SCOPES.size(), 0);
+
+    std::vector<ProfileScopeStats> stats(SCOPES.size());
+
+    for (const auto& event : EVENTS)
+    {
+        if (event.Scope >= SCOPES.size())
+        {
+            continue;
+        }
+
+        const uint64_t DURATION = event.End - event.Start;
+
+        durations[event.Scope].push_back(DURATION);
+
+        if (event.Start >= lastStarts[event.Scope])
+        {
+            lastStarts[event.Scope] = event.Start;
+            stats[event.Scope].LastNanoseconds = DURATION;
+        }
+    }
+
+    std::vector<ProfileScopeStats> result;
+
+    for (size_t scope = 0; scope < SCOPES.size(); ++scope)
+    {
+        auto& samples = durations[scope];
+
+        if (samples.empty())
+        {
+            continue;
+        }
+
+        std::ranges::sort(samples);
+
+        uint64_t total = 0;
+        for (const uint64_t DURATION : samples)
+        {
+            total += DURATION;
+        }
+
+        // p99取最近秩：第ceil(0.99 * n)个样本
+        const size_t P99_RANK = (samples.size() * 99 + 99) / 100;
+
+        auto& entry = stats[scope];
+        entry.Name = SCOPES[scope].Name;
+        entry.Kind = SCOPES[scope].Kind;
+        entry.SampleCount = samples.size();
+        entry.MinNanoseconds = samples.front();
+        entry.MaxNanoseconds = samples.back();
+        entry.AvgNanoseconds = total / samples.size();
+        entry.P99Nanoseconds = samples[P99_RANK - 1];
+
+        result.push_back(std::move(entry));
+    }
+
+    return result;
+}
+
+
+void SystemProfiler::WriteChromeTrace(std::ostream& stream, size_t frameCount) const
+{
+    auto events = CollectEvents(frameCount);
+
+    const auto SCOPES = CopyScopes();
+
+    std::ranges::sort(events, [](const EventRecord& lhs, const EventRecord& rhs)
+                      { return lhs.Thread != rhs.Thread ? lhs.Thread < rhs.Thread : lhs.Start < rhs.Start; });
+
+    // 时间戳相对于最早的事件
+    uint64_t origin = UINT64_MAX;
+    for (const auto& event : events)
+    {
+        origin = std::min(origin, event.Start);
+    }
+
+    stream << "{\"traceEvents\":[";
+
+    bool first = true;
+
+    // 为每个线程输出名字
+    for (size_t index = 0; index < events.size(); ++index)
+    {
+        if (index > 0 && events[index].Thread == events[index - 1].Thread)
+        {
+            continue;
+        }
+
+        stream << (first ? "\n" : ",\n");
+        stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << events[index].Thread
+               << ",\"args\":{\"name\":\"Thread " << events[index].Thread << "\"}}";
+
+        first = false;
+    }
+
+    for (const auto& event : events)
+    {
+        if (event.Scope >= SCOPES.size())
+        {
+            continue;
+        }
+
+        stream << (first ? "\n" : ",\n");
+        stream << "{\"name\":";
+        WriteJsonString(stream, SCOPES[event.Scope].Name);
+        stream << ",\"cat\":\"" << GetKindName(SCOPES[event.Scope].Kind) << "\",\"ph\":\"X\",\"ts\":";
+        WriteMicroseconds(stream, event.Start - origin);
+        stream << ",\"dur\":";
+        WriteMicroseconds(stream, event.End - event.Start);
+        stream << ",\"pid\":1,\"tid\":" << event.Thread << "}";
+
+        first = false;
+    }
+
+    stream << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+
+uint64_t SystemProfiler::GetDroppedCount() const
+{
+    return Dropped.load(std::memory_order_relaxed);
+}
+
+
+bool SystemProfiler::SetHardwareCountersEnabled(bool enabled)
+{
+#if defined(__linux__)
+    const bool AVAILABLE = ENABLED && enabled && GetHardwareCounterGroup().IsAvailable();
+#else
+    const bool AVAILABLE = false;
+#endif
+
+    CountersEnabled.store(AVAILABLE, std::memory_order_relaxed);
+
+    return AVAILABLE;
+}
+
+
+void SystemProfiler::BeginCounterSample()
+{
+#if defined(__linux__)
+    auto& group = GetHardwareCounterGroup();
+
+    group.IsSampling = IsHardwareCountersEnabled() && group.Read(group.Begin);
+#endif
+}
+
+
+void SystemProfiler::EndCounterSample(ProfileScopeID scope, uint64_t entities)
+{
+#if defined(__linux__)
+    auto& group = GetHardwareCounterGroup();
+
+    if (!group.IsSampling)
+    {
+        return;
+    }
+
+    group.IsSampling = false;
+
+    CounterReading end;
+    if (!group.Read(end) || scope == INVALID_PROFILE_SCOPE_ID)
+    {
+        return;
+    }
+
+    // 组在采样期间没有运行时读数无意义；部分时间运行时按比例缩放
+    const uint64_t ENABLED_TIME = end.TimeEnabled - group.Begin.TimeEnabled;
+    const uint64_t RUNNING_TIME = end.TimeRunning - group.Begin.TimeRunning;
+
+    if (RUNNING_TIME == 0)
+    {
+        return;
+    }
+
+    ThreadBuffer* buffer = GetThreadBuffer();
+
+    if (buffer == nullptr)
+    {
+        Dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // 同一槽位同一时刻只有一个写入线程
+    auto* counters = buffer->Counters.load(std::memory_order_relaxed);
+    if (counters == nullptr)
+    {
+        counters = new EventRing<3 + HARDWARE_COUNTER_COUNT>();
+        buffer->Counters.store(counters, std::memory_order_release);
+    }
+
+    const uint64_t FRAME = FrameIndex.load(std::memory_order_relaxed) & UINT32_MAX;
+    const double   SCALE = static_cast<double>(ENABLED_TIME) / static_cast<double>(RUNNING_TIME);
+
+    EventRing<3 + HARDWARE_COUNTER_COUNT>::Values values{};
+    values[0] = (static_cast<uint64_t>(scope) << 32) | FRAME;
+    values[1] = entities;
+    values[2] = group.GetMask();
+
+    for (size_t counter = 0; counter < HARDWARE_COUNTER_COUNT; ++counter)
+    {
+        const uint64_t DELTA = end.Values[counter] - group.Begin.Values[counter];
+        values[3 + counter] = static_cast<uint64_t>(static_cast<double>(DELTA) * SCALE);
+    }
+
+    counters->Push(values);
+#else
+    (void)scope;
+    (void)entities;
+#endif
+}
+
+
+std::vector<SystemCounterStats> SystemProfiler::CollectCounterStats(size_t frameCount) const
+{
+    const auto SCOPES = CopyScopes();
+
+    const auto     CURRENT = static_cast<uint32_t>(FrameIndex.load(std::memory_order_acquire));
+    const uint64_t WINDOW = std::min<uint64_t>(frameCount, UINT32_MAX);
+
+    std::vector<SystemCounterStats> stats(SCOPES.size());
+
+    std::vector<EventRing<3 + HARDWARE_COUNTER_COUNT>::Values> raw;
+
+    for (const auto& entry : Buffers)
+    {
+        const ThreadBuffer* buffer = entry.load(std::memory_order_acquire);
+        const auto*         counters = buffer != nullptr ? buffer->Counters.load(std::memory_order_acquire) : nullptr;
+
+        if (counters == nullptr)
+        {
+            continue;
+        }
+
+        raw.clear();
+        counters->Read(raw);
+
+        for (const auto& values : raw)
+        {
+            const auto SCOPE = static_cast<ProfileScopeID>(values[0] >> 32);
+
+            if (!IsInFrameWindow(values[0], CURRENT, WINDOW) || SCOPE >= SCOPES.size())
+            {
+                continue;
+            }
+
+            auto& scopeStats = stats[SCOPE];
+            const auto MASK = static_cast<uint32_t>(values[2]);
+
+            scopeStats.AvailableMask = scopeStats.SampleCount == 0 ? MASK : scopeStats.AvailableMask & MASK;
+            scopeStats.SampleCount++;
+            scopeStats.Entities += values[1];
+
+            for (size_t counter = 0; counter < HARDWARE_COUNTER_COUNT; ++counter)
+            {
+                scopeStats.Totals[counter] += values[3 + counter];
+            }
+        }
+    }
+
+    std::vector<SystemCounterStats> result;
+
+    for (size_t scope = 0; scope < SCOPES.size(); ++scope)
+    {
+        auto& entry = stats[scope];
+
+        if (entry.SampleCount == 0)
+        {
+            continue;
+        }
+
+        entry.Name = SCOPES[scope].Name;
+
+        for (size_t counter = 0; counter < HARDWARE_COUNTER_COUNT; ++counter)
+        {
+            if ((entry.AvailableMask & (1U << counter)) == 0)
+            {
+                entry.Totals[counter] = 0;
+            }
+        }
+
+        const auto CYCLES = static_cast<double>(entry.GetTotal(HardwareCounter::Cycles));
+        const auto ENTITIES = static_cast<double>(entry.Entities);
+
+        if (CYCLES > 0.0)
+        {
+            entry.InstructionsPerCycle = static_cast<double>(entry.GetTotal(HardwareCounter::Instructions)) / CYCLES;
+        }
+
+        if (ENTITIES > 0.0)
+        {
+            entry.L1DataMissesPerEntity = static_cast<double>(entry.GetTotal(HardwareCounter::L1DataMisses)) / ENTITIES;
+            entry.LastLevelCacheMissesPerEntity =
+                static_cast<double>(entry.GetTotal(HardwareCounter::LastLevelCacheMisses)) / ENTITIES;
+            entry.BranchMissesPerEntity = static_cast<double>(entry.GetTotal(HardwareCounter::BranchMisses)) / ENTITIES;
+        }
+
+        result.push_back(std::move(entry));
+    }
+
+    return result;
+}
+
+
+std::vector<SystemProfiler::ScopeInfo> SystemProfiler::CopyScopes() const
+{
+    const std::lock_guard<std::mutex> LOCK(ScopeMutex);
+    return Scopes;
+}
+
+} // namespace NekiraECS
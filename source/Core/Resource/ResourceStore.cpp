@@ -0,0 +1,34 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#include <Resource/ResourceStore.hpp>
+#include <atomic>
+
+
+namespace NekiraECS
+{
+
+namespace
+{
+// 下一个可分配的资源类型ID
+std::atomic<ResourceTypeID> NextResourceTypeID{0};
+} // namespace
+
+
+ResourceTypeID ResourceTypeRegistry::NextID()
+{
+    return NextResourceTypeID.fetch_add(1, std::memory_order_relaxed);
+}
+
+
+void ResourceStore::Clear()
+{
+    Resources.clear();
+}
+
+} // namespace NekiraECS
@@ -0,0 +1,238 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#include <Snapshot/SnapshotRing.hpp>
+#include <World/World.hpp>
+#include <algorithm>
+
+
+namespace NekiraECS
+{
+
+SnapshotRing::SnapshotRing(World& world, size_t capacity) : Owner(&world), Frames(std::max<size_t>(capacity, 1))
+{}
+
+
+bool SnapshotRing::Save(FrameType frame)
+{
+    auto& components = Owner->GetComponentManager();
+    auto& entities = Owner->GetEntityManager();
+
+    if (components.GetStorageMode() != ComponentStorageMode::SparseSet)
+    {
+        return false;
+    }
+
+    // 丢弃不小于frame的帧
+    while (Count > 0 && GetFrame(Count - 1).Number >= frame)
+    {
+        --Count;
+    }
+
+    size_t slot = (Head + Count) % Frames.size();
+
+    if (Count == Frames.size())
+    {
+        slot = Head;
+        Head = (Head + 1) % Frames.size();
+    }
+    else
+    {
+        ++Count;
+    }
+
+    auto& target = Frames[slot];
+
+    target.Number = frame;
+
+    // 复制赋值会复用已有的容量
+    target.EntityVersions = entities.EntityVersions;
+    target.RecycledIDs = entities.RecycledIDs;
+
+    const auto& arrays = components.ComponentArrays;
+
+    target.States.resize(arrays.size());
+    CurrentStates.resize(arrays.size());
+
+    for (size_t typeID = 0; typeID < arrays.size(); ++typeID)
+    {
+        auto& state = target.States[typeID];
+
+        if (!arrays[typeID].IsValid() || !arrays[typeID]->CanSaveState())
+        {
+            state.reset();
+            continue;
+        }
+
+        const auto& compArray = arrays[typeID];
+
+        // 未修改的容器与上一次保存共享同一个状态
+        if (!compArray->IsModified() && (CurrentStates[typeID] != nullptr || compArray->IsEmpty()))
+        {
+            state = CurrentStates[typeID];
+            continue;
+        }
+
+        if (compArray->IsEmpty())
+        {
+            state.reset();
+        }
+        else
+        {
+            // 被覆盖的状态不再被其他帧共享时复用它的缓冲
+            std::shared_ptr<IComponentArrayState> reuse;
+
+            if (state.use_count() == 1)
+            {
+                reuse = std::move(state);
+            }
+
+            state = compArray->SaveState(std::move(reuse));
+        }
+
+        CurrentStates[typeID] = state;
+        compArray->ClearModified();
+    }
+
+    target.Groups.resize(components.Groups.size());
+
+    for (size_t index = 0; index < components.Groups.size(); ++index)
+    {
+        target.Groups[index].TypeIDs = components.Groups[index].TypeIDs;
+        target.Groups[index].Size = components.Groups[index].Group->Size();
+    }
+
+    return true;
+}
+
+
+bool SnapshotRing::Restore(FrameType frame)
+{
+    auto& components = Owner->GetComponentManager();
+    auto& entities = Owner->GetEntityManager();
+
+    const size_t INDEX = FindFrame(frame);
+
+    if (components.GetStorageMode() != ComponentStorageMode::SparseSet || INDEX == Count)
+    {
+        return false;
+    }
+
+    const auto& source = GetFrame(INDEX);
+
+    entities.EntityVersions = source.EntityVersions;
+    entities.RecycledIDs = source.RecycledIDs;
+
+    const auto& arrays = components.ComponentArrays;
+
+    CurrentStates.resize(arrays.size());
+
+    for (size_t typeID = 0; typeID < arrays.size(); ++typeID)
+    {
+        if (!arrays[typeID].IsValid() || !arrays[typeID]->CanSaveState())
+        {
+            continue;
+        }
+
+        const auto& compArray = arrays[typeID];
+
+        // 保存之后才创建的容器恢复为空
+        const auto& state = typeID < source.States.size() ? source.States[typeID] : nullptr;
+
+        // 内容已与目标帧一致
+        if (!compArray->IsModified() && CurrentStates[typeID] == state
+            && (state != nullptr || compArray->IsEmpty()))
+        {
+            continue;
+        }
+
+        compArray->RestoreState(state.get());
+
+        CurrentStates[typeID] = state;
+        compArray->ClearModified();
+    }
+
+    // 组内实体数量与容器一起恢复，保存之后才创建的组重新收集组内实体
+    for (const auto& entry : components.Groups)
+    {
+        const auto IT = std::ranges::find(source.Groups, entry.TypeIDs, &GroupRecord::TypeIDs);
+
+        if (IT != source.Groups.end())
+        {
+            entry.Group->OnArraysRestored(IT->Size);
+        }
+        else
+        {
+            entry.Group->Rebuild();
+        }
+    }
+
+    Count = INDEX + 1;
+
+    return true;
+}
+
+
+bool SnapshotRing::Contains(FrameType frame) const
+{
+    return FindFrame(frame) != Count;
+}
+
+
+size_t SnapshotRing::Size() const
+{
+    return Count;
+}
+
+
+size_t SnapshotRing::GetCapacity() const
+{
+    return Frames.size();
+}
+
+
+void SnapshotRing::Clear()
+{
+    Head = 0;
+    Count = 0;
+
+    for (auto& frame : Frames)
+    {
+        frame.States.clear();
+    }
+
+    CurrentStates.clear();
+}
+
+
+SnapshotRing::Frame& SnapshotRing::GetFrame(size_t index)
+{
+    return Frames[(Head + index) % Frames.size()];
+}
+
+
+const SnapshotRing::Frame& SnapshotRing::GetFrame(size_t index) const
+{
+    return Frames[(Head + index) % Frames.size()];
+}
+
+
+size_t SnapshotRing::FindFrame(FrameType frame) const
+{
+    for (size_t index = 0; index < Count; ++index)
+    {
+        if (GetFrame(index).Number == frame)
+        {
+            return index;
+        }
+    }
+
+    return Count;
+}
+
+} // namespace NekiraECS
@@ -0,0 +1,546 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#include <Snapshot/WorldSnapshot.hpp>
+#include <World/World.hpp>
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stack>
+
+
+namespace NekiraECS
+{
+
+namespace
+{
+// 魔数"NKECSSNP"
+constexpr uint64_t SNAPSHOT_MAGIC = 0x504E535343454B4EULL;
+
+// 格式版本，布局变化时递增
+constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+// 文件头
+struct SnapshotHeader final
+{
+    uint64_t Magic;
+    uint32_t Version;
+    uint16_t EntityIDBits;
+    uint16_t EntityIndexBits;
+
+    uint64_t VersionCount;
+    uint64_t VersionsOffset;
+
+    uint64_t RecycledCount;
+    uint64_t RecycledOffset;
+
+    uint64_t TypeCount;
+    uint64_t TypeTableOffset;
+};
+
+// 类型表的一项
+struct SnapshotTypeEntry final
+{
+    uint64_t NameHash;
+    uint64_t Count;
+
+    uint64_t EntitiesOffset;
+    uint64_t DataOffset;
+    uint64_t DataSize;
+
+    uint32_t ElementSize;
+    uint32_t IsRaw;
+};
+
+// 所有注册的类型
+struct SnapshotTypeRegistry final
+{
+    std::mutex Mutex;
+
+    std::vector<SnapshotTypeInfo> Types;
+};
+
+SnapshotTypeRegistry& GetRegistry()
+{
+    static SnapshotTypeRegistry registry;
+    return registry;
+}
+
+// 写入一个对齐的区段，返回它的偏移量
+size_t WriteSection(SnapshotWriter& writer, const void* data, size_t size)
+{
+    writer.Align(WorldSnapshot::SNAPSHOT_ALIGNMENT);
+
+    const size_t OFFSET = writer.GetPosition();
+    writer.Write(data, size);
+
+    return OFFSET;
+}
+
+// [offset, offset + size)是否位于total字节之内
+bool IsRangeValid(uint64_t offset, uint64_t size, size_t total)
+{
+    return offset <= total && size <= total - offset;
+}
+
+// count个elementSize字节的元素组成的区段是否位于total字节之内
+bool IsArrayValid(uint64_t offset, uint64_t count, size_t elementSize, size_t total)
+{
+    return count <= total / elementSize && IsRangeValid(offset, count * elementSize, total);
+}
+
+// 复制count个T组成的区段，不要求区段的起始地址满足T的对齐
+template <typename T>
+std::vector<T> CopySection(std::span<const std::byte> data, uint64_t offset, uint64_t count)
+{
+    std::vector<T> result(static_cast<size_t>(count));
+
+    if (!result.empty())
+    {
+        std::memcpy(result.data(), data.data() + offset, result.size() * sizeof(T));
+    }
+
+    return result;
+}
+
+// 按SNAPSHOT_ALIGNMENT对齐的缓冲
+struct AlignedBuffer final
+{
+    explicit AlignedBuffer(size_t size) :
+        Storage(std::make_unique_for_overwrite<std::byte[]>(size + WorldSnapshot::SNAPSHOT_ALIGNMENT))
+    {
+        void*  aligned = Storage.get();
+        size_t space = size + WorldSnapshot::SNAPSHOT_ALIGNMENT;
+
+        Data = static_cast<std::byte*>(std::align(WorldSnapshot::SNAPSHOT_ALIGNMENT, size, aligned, space));
+        Size = size;
+    }
+
+    [[nodiscard]] std::span<const std::byte> GetSpan() const
+    {
+        return {Data, Size};
+    }
+
+    std::unique_ptr<std::byte[]> Storage;
+
+    std::byte* Data = nullptr;
+
+    size_t Size = 0;
+};
+
+// 获取当前所有注册类型的快照
+std::vector<SnapshotTypeInfo> CopyTypes()
+{
+    auto& registry = GetRegistry();
+
+    const std::scoped_lock LOCK(registry.Mutex);
+    return registry.Types;
+}
+} // namespace
+
+
+SnapshotWriter::SnapshotWriter(std::vector<std::byte>& buffer) : Buffer(buffer)
+{}
+
+
+void SnapshotWriter::Write(const void* data, size_t size)
+{
+    if (size == 0)
+    {
+        return;
+    }
+
+    const size_t OLD_SIZE = Buffer.size();
+
+    Buffer.resize(OLD_SIZE + size);
+    std::memcpy(Buffer.data() + OLD_SIZE, data, size);
+}
+
+
+void SnapshotWriter::Align(size_t alignment)
+{
+    const size_t SIZE = Buffer.size();
+
+    Buffer.resize((SIZE + alignment - 1) / alignment * alignment, std::byte{0});
+}
+
+
+void SnapshotWriter::Overwrite(size_t position, const void* data, size_t size)
+{
+    std::memcpy(Buffer.data() + position, data, size);
+}
+
+
+size_t SnapshotWriter::GetPosition() const
+{
+    return Buffer.size();
+}
+
+
+SnapshotReader::SnapshotReader(std::span<const std::byte> data) : Data(data)
+{}
+
+
+bool SnapshotReader::Read(void* out, size_t size)
+{
+    if (!Good || size > Data.size() - Position)
+    {
+        Good = false;
+        return false;
+    }
+
+    std::memcpy(out, Data.data() + Position, size);
+    Position += size;
+
+    return true;
+}
+
+
+bool SnapshotReader::IsGood() const
+{
+    return Good;
+}
+
+
+size_t SnapshotReader::GetRemaining() const
+{
+    return Data.size() - Position;
+}
+
+
+uint64_t WorldSnapshot::HashName(std::string_view name)
+{
+    constexpr uint64_t FNV_OFFSET = 14695981039346656037ULL;
+    constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+    uint64_t hash = FNV_OFFSET;
+
+    for (const char CH : name)
+    {
+        hash ^= static_cast<uint8_t>(CH);
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+
+void WorldSnapshot::Register(const SnapshotTypeInfo& info)
+{
+    auto& registry = GetRegistry();
+
+    const std::scoped_lock LOCK(registry.Mutex);
+
+    std::erase_if(registry.Types, [&info](const SnapshotTypeInfo& type)
+                  { return type.ID == info.ID || type.NameHash == info.NameHash; });
+
+    registry.Types.push_back(info);
+}
+
+
+bool WorldSnapshot::Save(World& world, std::vector<std::byte>& outBuffer)
+{
+    auto& components = world.GetComponentManager();
+    auto& entities = world.GetEntityManager();
+
+    if (components.GetStorageMode() != ComponentStorageMode::SparseSet)
+    {
+        return false;
+    }
+
+    outBuffer.clear();
+
+    SnapshotWriter writer(outBuffer);
+
+    SnapshotHeader header{};
+    header.Magic = SNAPSHOT_MAGIC;
+    header.Version = SNAPSHOT_VERSION;
+    header.EntityIDBits = static_cast<uint16_t>(sizeof(EntityIDType) * 8);
+    header.EntityIndexBits = EntityIDLayout::INDEX_BITS;
+
+    // 先占位，最后回填
+    writer.Write(header);
+
+    // 实体版本号
+    header.VersionCount = entities.EntityVersions.size();
+    header.VersionsOffset = WriteSection(writer, entities.EntityVersions.data(),
+                                         entities.EntityVersions.size() * sizeof(EntityVersionType));
+
+    // 回收ID，按栈底到栈顶的顺序写入
+    auto                      recycledStack = entities.RecycledIDs;
+    std::vector<EntityIDType> recycled(recycledStack.size());
+
+    for (size_t index = recycled.size(); index > 0; --index)
+    {
+        recycled[index - 1] = recycledStack.top();
+        recycledStack.pop();
+    }
+
+    header.RecycledCount = recycled.size();
+    header.RecycledOffset = WriteSection(writer, recycled.data(), recycled.size() * sizeof(EntityIDType));
+
+    // 组件区段
+    std::vector<SnapshotTypeEntry> entries;
+
+    for (const auto& type : CopyTypes())
+    {
+        if (type.ID >= components.ComponentArrays.size() || !components.ComponentArrays[type.ID].IsValid())
+        {
+            continue;
+        }
+
+        const auto& handle = components.ComponentArrays[type.ID];
+
+        if (handle->IsEmpty())
+        {
+            continue;
+        }
+
+        SnapshotTypeEntry entry{};
+        entry.NameHash = type.NameHash;
+        entry.Count = handle->Size();
+        entry.ElementSize = type.ElementSize;
+        entry.IsRaw = type.IsRaw ? 1 : 0;
+
+        const auto& entityIndices = handle->GetEntityIndices();
+
+        entry.EntitiesOffset =
+            WriteSection(writer, entityIndices.data(), entityIndices.size() * sizeof(EntityIndexType));
+
+        writer.Align(SNAPSHOT_ALIGNMENT);
+        entry.DataOffset = writer.GetPosition();
+
+        type.SaveData(components, writer);
+
+        entry.DataSize = writer.GetPosition() - entry.DataOffset;
+
+        entries.push_back(entry);
+    }
+
+    header.TypeCount = entries.size();
+    header.TypeTableOffset = WriteSection(writer, entries.data(), entries.size() * sizeof(SnapshotTypeEntry));
+
+    writer.Overwrite(0, &header, sizeof(header));
+
+    return true;
+}
+
+
+bool WorldSnapshot::SaveToFile(World& world, const std::string& path)
+{
+    std::vector<std::byte> buffer;
+
+    if (!Save(world, buffer))
+    {
+        return false;
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+    if (!file)
+    {
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+
+    return static_cast<bool>(file);
+}
+
+
+bool WorldSnapshot::Load(World& world, std::span<const std::byte> data)
+{
+    auto& components = world.GetComponentManager();
+    auto& entities = world.GetEntityManager();
+
+    if (components.GetStorageMode() != ComponentStorageMode::SparseSet || data.size() < sizeof(SnapshotHeader))
+    {
+        return false;
+    }
+
+    /**
+     * @[INFO] 加载逻辑：
+     *
+     * 1.校验文件头、实体ID布局、所有区段的范围以及原始字节区段的大小，任何一项失败都直接返回，World保持不变。
+     * 2.清空所有组件容器，整段复制实体版本号与回收ID。
+     * 3.对每个已注册的类型，复制实体索引区段，再由类型信息读取组件数据并接管为组件容器的紧凑集合。
+     */
+    // 按原始字节读取的组件要求数据满足对齐，未对齐时先复制到对齐的缓冲
+    if (reinterpret_cast<uintptr_t>(data.data()) % SNAPSHOT_ALIGNMENT != 0)
+    {
+        AlignedBuffer buffer(data.size());
+        std::memcpy(buffer.Data, data.data(), data.size());
+
+        return Load(world, buffer.GetSpan());
+    }
+
+    SnapshotHeader header{};
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    if (header.Magic != SNAPSHOT_MAGIC || header.Version != SNAPSHOT_VERSION
+        || header.EntityIDBits != sizeof(EntityIDType) * 8 || header.EntityIndexBits != EntityIDLayout::INDEX_BITS)
+    {
+        return false;
+    }
+
+    const size_t TOTAL = data.size();
+
+    if (!IsArrayValid(header.VersionsOffset, header.VersionCount, sizeof(EntityVersionType), TOTAL)
+        || !IsArrayValid(header.RecycledOffset, header.RecycledCount, sizeof(EntityIDType), TOTAL)
+        || !IsArrayValid(header.TypeTableOffset, header.TypeCount, sizeof(SnapshotTypeEntry), TOTAL))
+    {
+        return false;
+    }
+
+    const auto ENTRIES = CopySection<SnapshotTypeEntry>(data, header.TypeTableOffset, header.TypeCount);
+
+    const auto TYPES = CopyTypes();
+
+    std::vector<const SnapshotTypeInfo*>      infos(ENTRIES.size(), nullptr);
+    std::vector<std::vector<EntityIndexType>> entityIndices(ENTRIES.size());
+
+    // 标记某个实体是否已在当前类型中出现过
+    std::vector<bool> seen(header.VersionCount, false);
+
+    for (size_t index = 0; index < ENTRIES.size(); ++index)
+    {
+        const auto& entry = ENTRIES[index];
+
+        if (!IsArrayValid(entry.EntitiesOffset, entry.Count, sizeof(EntityIndexType), TOTAL)
+            || !IsRangeValid(entry.DataOffset, entry.DataSize, TOTAL))
+        {
+            return false;
+        }
+
+        const auto IT = std::ranges::find(TYPES, entry.NameHash, &SnapshotTypeInfo::NameHash);
+
+        // 未注册的类型跳过
+        if (IT == TYPES.end())
+        {
+            continue;
+        }
+
+        if (IT->IsRaw != (entry.IsRaw != 0) || IT->ElementSize != entry.ElementSize)
+        {
+            return false;
+        }
+
+        // 同一类型只能出现一次，否则第二次接管时组件容器已非空
+        if (std::ranges::find(infos, &*IT) != infos.end())
+        {
+            return false;
+        }
+
+        // 原始字节的区段大小必须与组件数量一致，且起始位置满足对齐，LoadData不会再失败
+        if (IT->IsRaw
+            && (entry.DataSize != entry.Count * entry.ElementSize || entry.DataOffset % SNAPSHOT_ALIGNMENT != 0))
+        {
+            return false;
+        }
+
+        // 实体索引必须指向快照中存在的实体，且不能重复
+        auto indices = CopySection<EntityIndexType>(data, entry.EntitiesOffset, entry.Count);
+
+        for (const auto ENTITY_INDEX : indices)
+        {
+            if (ENTITY_INDEX >= header.VersionCount || seen[ENTITY_INDEX])
+            {
+                return false;
+            }
+
+            seen[ENTITY_INDEX] = true;
+        }
+
+        for (const auto ENTITY_INDEX : indices)
+        {
+            seen[ENTITY_INDEX] = false;
+        }
+
+        infos[index] = &*IT;
+        entityIndices[index] = std::move(indices);
+    }
+
+    // 回收的ID必须指向快照中存在的实体，且同一索引只能回收一次，否则之后创建实体时会越界访问版本号
+    const auto RECYCLED = CopySection<EntityIDType>(data, header.RecycledOffset, header.RecycledCount);
+
+    for (const auto ID : RECYCLED)
+    {
+        const auto ENTITY_INDEX = EntityManager::GetEntityIndex(ID);
+
+        if (ENTITY_INDEX >= header.VersionCount || seen[ENTITY_INDEX])
+        {
+            return false;
+        }
+
+        seen[ENTITY_INDEX] = true;
+    }
+
+    // 清空已有的组件，组与观察者保持订阅
+    for (auto& compArray : components.ComponentArrays)
+    {
+        if (compArray.IsValid())
+        {
+            compArray->Clear();
+        }
+    }
+
+    // 逐元素赋值，保留EntityManager自己的memory_resource
+    const auto VERSIONS = CopySection<EntityVersionType>(data, header.VersionsOffset, header.VersionCount);
+
+    entities.EntityVersions.assign(VERSIONS.begin(), VERSIONS.end());
+
+    entities.RecycledIDs = EntityManager::RecycledStack(
+        EntityManager::RecycledStack::container_type(RECYCLED.begin(), RECYCLED.end(), entities.GetMemoryResource()));
+
+    bool succeeded = true;
+
+    for (size_t index = 0; index < ENTRIES.size(); ++index)
+    {
+        if (infos[index] == nullptr)
+        {
+            continue;
+        }
+
+        const auto& entry = ENTRIES[index];
+
+        succeeded =
+            infos[index]->LoadData(components, entityIndices[index], data.subspan(entry.DataOffset, entry.DataSize))
+            && succeeded;
+    }
+
+    return succeeded;
+}
+
+
+bool WorldSnapshot::LoadFromFile(World& world, const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+
+    if (!file)
+    {
+        return false;
+    }
+
+    const auto SIZE = static_cast<size_t>(file.tellg());
+    file.seekg(0);
+
+    // 按SNAPSHOT_ALIGNMENT对齐缓冲，使区段中的组件可以直接整段复制
+    AlignedBuffer buffer(SIZE);
+
+    if (!file.read(reinterpret_cast<char*>(buffer.Data), static_cast<std::streamsize>(SIZE)))
+    {
+        return false;
+    }
+
+    return Load(world, buffer.GetSpan());
+}
+
+} // namespace NekiraECS
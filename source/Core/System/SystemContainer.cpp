@@ -16,6 +16,7 @@ namespace NekiraECS
 void SystemContainer::AddSystem(std::unique_ptr<ISystemBase> system)
 {
     IsSorted = false;
+    IsScheduleDirty = true;
 
     // 检查系统是否存在
     for (auto& sys : Systems)
@@ -40,6 +41,7 @@ void SystemContainer::RemoveSystem(std::type_index type)
     Systems.erase(newBegin, newEnd);
 
     IsSorted = false;
+    IsScheduleDirty = true;
 }
 
 
@@ -69,15 +71,133 @@ void SystemContainer::SortingSystems()
     const auto SORT_LAMBDA = [](const std::unique_ptr<ISystemBase>& a, const std::unique_ptr<ISystemBase>& b)
     { return a->GetPriority() < b->GetPriority(); };
 
-    std::ranges::sort(Systems.begin(), Systems.end(), SORT_LAMBDA);
+    std::ranges::stable_sort(Systems.begin(), Systems.end(), SORT_LAMBDA);
 
     IsSorted = true;
+    IsScheduleDirty = true;
 }
 
 
-const std::vector<std::unique_ptr<ISystemBase>>& SystemContainer::GetAllSystems() const
+const std::pmr::vector<std::unique_ptr<ISystemBase>>& SystemContainer::GetAllSystems() const
 {
     return Systems;
 }
 
-} // namespace NekiraECS
\ No newline at end of file
+
+
+void SystemContainer::UpdateSystems(float deltaTime, ThreadPool* pool, ComponentTick tick, SystemProfiler* profiler)
+{
+    if (pool == nullptr || Systems.size() < 2)
+    {
+        // 顺序执行时，上一个系统的结束时间即下一个系统的开始时间，每个系统只需读取一次时钟
+        const bool PROFILING = profiler != nullptr && profiler->IsEnabled();
+        const bool COUNTING = PROFILING && profiler->IsHardwareCountersEnabled();
+        uint64_t   start = PROFILING ? SystemProfiler::Now() : 0;
+
+        for (const auto& system : Systems)
+        {
+            if (COUNTING)
+            {
+                system->ProcessedEntities = 0;
+                profiler->BeginCounterSample();
+            }
+
+            system->OnUpdate(deltaTime);
+            system->LastRunTick = tick;
+
+            if (COUNTING)
+            {
+                profiler->EndCounterSample(system->ProfilerScope, system->ProcessedEntities);
+            }
+
+            if (PROFILING)
+            {
+                const uint64_t END = SystemProfiler::Now();
+                profiler->Record(system->ProfilerScope, start, END);
+                start = END;
+            }
+        }
+
+        return;
+    }
+
+    if (IsScheduleDirty)
+    {
+        BuildSchedule();
+    }
+
+    ScheduleDeltaTime = deltaTime;
+    ScheduleTick = tick;
+    ScheduleProfiler = profiler;
+
+    Schedule.Run(*pool);
+}
+
+
+void SystemContainer::RunSystem(ISystemBase& system, float deltaTime, ComponentTick tick, SystemProfiler* profiler)
+{
+    if (profiler != nullptr && profiler->IsEnabled())
+    {
+        const bool COUNTING = profiler->IsHardwareCountersEnabled();
+
+        if (COUNTING)
+        {
+            system.ProcessedEntities = 0;
+            profiler->BeginCounterSample();
+        }
+
+        const uint64_t START = SystemProfiler::Now();
+        system.OnUpdate(deltaTime);
+        const uint64_t END = SystemProfiler::Now();
+
+        if (COUNTING)
+        {
+            profiler->EndCounterSample(system.ProfilerScope, system.ProcessedEntities);
+        }
+
+        profiler->Record(system.ProfilerScope, START, END);
+    }
+    else
+    {
+        system.OnUpdate(deltaTime);
+    }
+
+    system.LastRunTick = tick;
+}
+
+
+void SystemContainer::BuildSchedule()
+{
+    /**
+     * @[INFO] 依赖图构建逻辑：
+     *
+     * 1.Systems已按优先级排好序，每个系统对应依赖图中的一个任务。
+     * 2.对于排在前面的系统i和排在后面的系统j，只有当二者的组件访问冲突时才添加依赖i -> j。
+     *   因此优先级顺序只在访问冲突时生效，互不冲突的系统可以并行执行。
+     * 3.未声明访问的系统与所有系统冲突，会按优先级顺序独占执行。
+     */
+    Schedule.Clear();
+
+    for (const auto& system : Systems)
+    {
+        ISystemBase* systemPtr = system.get();
+
+        Schedule.AddTask(
+            [this, systemPtr] { RunSystem(*systemPtr, ScheduleDeltaTime, ScheduleTick, ScheduleProfiler); });
+    }
+
+    for (size_t later = 1; later < Systems.size(); ++later)
+    {
+        for (size_t earlier = 0; earlier < later; ++earlier)
+        {
+            if (Systems[earlier]->GetAccess().ConflictsWith(Systems[later]->GetAccess()))
+            {
+                Schedule.AddDependency(earlier, later);
+            }
+        }
+    }
+
+    IsScheduleDirty = false;
+}
+
+} // namespace NekiraECS
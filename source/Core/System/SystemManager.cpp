@@ -7,14 +7,14 @@
  */
 
 #include <System/SystemManager.hpp>
+#include <World/World.hpp>
 #include <algorithm>
 
 namespace NekiraECS
 {
 SystemManager& SystemManager::Get()
 {
-    static SystemManager instance;
-    return instance;
+    return World::GetDefault().GetSystemManager();
 }
 
 
@@ -41,8 +41,7 @@ void SystemManager::SortSystemGroups()
 
 void SystemManager::UpdateSystemGroups(float deltaTime)
 {
-    //@[TODO] 这里可以考虑多线程更新不同分组的系统
-
+    // 分组之间按顺序执行，分组内部在开启多线程时按依赖图并行执行
     for (auto group : SYSTEM_GROUPS)
     {
         if (!SystemGroups.contains(group))
@@ -50,16 +49,57 @@ void SystemManager::UpdateSystemGroups(float deltaTime)
             continue;
         }
 
-        for (const auto& system : SystemGroups[group]->GetAllSystems())
-        {
-            system->OnUpdate(deltaTime);
-        }
+        // 分组耗时包括命令回放与组件事件分发
+        const ProfileScope GROUP_SCOPE(Profiler, Profiler.GetGroupScope(group));
+
+        // 每个分组使用新的Tick，分组内的修改都记录为该Tick
+        auto& components = OwnerWorld->GetComponentManager();
+        components.AdvanceTick();
+
+        SystemGroups[group]->UpdateSystems(deltaTime, Workers.get(), components.GetCurrentTick(), &Profiler);
+
+        // 分组之间是同步点，在此回放该分组记录的命令，再分发该分组(包括回放)产生的组件事件
+        Commands.Playback(*OwnerWorld);
+        components.FlushComponentEvents();
     }
 }
 
 
+void SystemManager::SetWorkerCount(size_t workerCount)
+{
+    Workers = workerCount > 0 ? std::make_unique<ThreadPool>(workerCount) : nullptr;
+}
+
+
+size_t SystemManager::GetWorkerCount() const
+{
+    return Workers != nullptr ? Workers->GetWorkerCount() : 0;
+}
+
+
+ThreadPool* SystemManager::GetThreadPool() const
+{
+    return Workers.get();
+}
+
+
+CommandBuffer& SystemManager::GetCommandBuffer()
+{
+    return Commands;
+}
+
+
+SystemProfiler& SystemManager::GetProfiler()
+{
+    return Profiler;
+}
+
+
 void SystemManager::Update(float deltaTime)
 {
+    Profiler.BeginFrame();
+    const ProfileScope FRAME_SCOPE(Profiler, Profiler.GetFrameScope());
+
     // 先对脏分组进行排序
     SortSystemGroups();
 
@@ -0,0 +1,151 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+
+#include <World/World.hpp>
+
+
+
+namespace NekiraECS
+{
+
+World::World(std::pmr::memory_resource* resource)
+    : MemoryResource(resource), Entities(resource), Components(resource), Systems(this, resource)
+{
+    // 变化追踪的移除日志需要记录完整实体
+    Components.EntitySource = &Entities;
+}
+
+World::~World() = default;
+
+void World::FlushComponentEvents()
+{
+    Components.FlushComponentEvents();
+}
+
+World& World::GetDefault()
+{
+    static World instance;
+    return instance;
+}
+
+std::pmr::memory_resource* World::GetMemoryResource() const
+{
+    return MemoryResource;
+}
+
+EntityManager& World::GetEntityManager()
+{
+    return Entities;
+}
+
+ComponentManager& World::GetComponentManager()
+{
+    return Components;
+}
+
+SystemManager& World::GetSystemManager()
+{
+    return Systems;
+}
+
+ResourceStore& World::GetResourceStore()
+{
+    return Resources;
+}
+
+bool World::CheckEntity(const Entity& entity) const
+{
+    return Entities.IsValid(entity);
+}
+
+Entity World::CreateEntity()
+{
+    return Entities.CreateEntity();
+}
+
+void World::DestroyEntity(const Entity& entity)
+{
+    if (CheckEntity(entity))
+    {
+        // 移除实体的所有组件
+        Components.RemoveEntityAllComponents(EntityManager::GetEntityIndex(entity));
+
+        Entities.DestroyEntity(entity);
+    }
+}
+
+void World::ForEachEntity(const std::function<void(const Entity&)>& callback) const
+{
+    Entities.ForEachEntity(callback);
+}
+
+WorldMemoryUsage World::GetMemoryUsage() const
+{
+    return WorldMemoryUsage{.Entities = Entities.GetMemoryUsage(), .Components = Components.GetMemoryUsage()};
+}
+
+size_t World::CreateEntities(size_t count, std::vector<Entity>& outEntities)
+{
+    return Entities.CreateEntities(count, outEntities);
+}
+
+void World::DestroyEntities(std::span<const Entity> entities)
+{
+    std::vector<EntityIndexType> entityIndices;
+    entityIndices.reserve(entities.size());
+
+    for (const auto& entity : entities)
+    {
+        if (CheckEntity(entity))
+        {
+            entityIndices.push_back(EntityManager::GetEntityIndex(entity));
+        }
+    }
+
+    // 先按组件类型批量移除组件，再销毁实体
+    Components.RemoveEntitiesAllComponents(entityIndices);
+
+    Entities.DestroyEntities(entities);
+}
+
+void World::RemoveEntityAllComponents(const Entity& entity)
+{
+    if (CheckEntity(entity))
+    {
+        auto entityIndex = EntityManager::GetEntityIndex(entity);
+        Components.RemoveEntityAllComponents(entityIndex);
+    }
+}
+
+bool World::SetComponentStorageMode(ComponentStorageMode mode)
+{
+    return Components.SetStorageMode(mode);
+}
+
+void World::UpdateSystems(float deltaTime)
+{
+    Systems.Update(deltaTime);
+}
+
+void World::SetSystemWorkerCount(size_t workerCount)
+{
+    Systems.SetWorkerCount(workerCount);
+}
+
+CommandBuffer& World::GetCommandBuffer()
+{
+    return Systems.GetCommandBuffer();
+}
+
+SystemProfiler& World::GetSystemProfiler()
+{
+    return Systems.GetProfiler();
+}
+
+} // namespace NekiraECS
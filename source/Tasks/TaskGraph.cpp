@@ -0,0 +1,95 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#include <TaskGraph.hpp>
+
+
+namespace NekiraECS
+{
+
+TaskID TaskGraph::AddTask(std::function<void()> func)
+{
+    Nodes.push_back(Node{.Func = std::move(func), .Successors = {}, .Predecessors = 0});
+
+    // 任务数量变化，执行时重新分配依赖计数
+    RemainingDependencies.reset();
+
+    return Nodes.size() - 1;
+}
+
+
+void TaskGraph::AddDependency(TaskID before, TaskID after)
+{
+    Nodes[before].Successors.push_back(after);
+    ++Nodes[after].Predecessors;
+}
+
+
+size_t TaskGraph::Size() const
+{
+    return Nodes.size();
+}
+
+
+void TaskGraph::Clear()
+{
+    Nodes.clear();
+    RemainingDependencies.reset();
+}
+
+
+void TaskGraph::Run(ThreadPool& pool)
+{
+    if (Nodes.empty())
+    {
+        return;
+    }
+
+    if (RemainingDependencies == nullptr)
+    {
+        RemainingDependencies = std::make_unique<std::atomic<size_t>[]>(Nodes.size());
+    }
+
+    for (size_t task = 0; task < Nodes.size(); ++task)
+    {
+        RemainingDependencies[task].store(Nodes[task].Predecessors, std::memory_order_relaxed);
+    }
+
+    TaskCounter counter;
+    counter.Add(Nodes.size());
+
+    // 提交所有没有前驱的任务
+    for (size_t task = 0; task < Nodes.size(); ++task)
+    {
+        if (Nodes[task].Predecessors == 0)
+        {
+            pool.Submit([this, task, &pool, &counter] { Execute(task, pool, counter); });
+        }
+    }
+
+    pool.Wait(counter);
+}
+
+
+void TaskGraph::Execute(TaskID task, ThreadPool& pool, TaskCounter& counter)
+{
+    Nodes[task].Func();
+
+    for (auto successor : Nodes[task].Successors)
+    {
+        // 最后一个完成的前驱负责提交后继
+        if (RemainingDependencies[successor].fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            pool.Submit([this, successor, &pool, &counter] { Execute(successor, pool, counter); });
+        }
+    }
+
+    counter.Done();
+}
+
+} // namespace NekiraECS
@@ -0,0 +1,196 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * For full license information, please view the LICENSE file in the root directory of this project.
+ */
+
+#include <ThreadPool.hpp>
+#include <algorithm>
+
+
+namespace NekiraECS
+{
+
+namespace
+{
+// 当前线程所属的线程池及其工作线程索引，用于把工作线程提交的任务放入自己的队列
+thread_local const ThreadPool* CurrentPool = nullptr;
+thread_local size_t            CurrentWorker = 0;
+} // namespace
+
+
+ThreadPool::ThreadPool(size_t workerCount)
+{
+    // 至少保留一个队列，0个工作线程时任务由调用Wait的线程执行
+    const size_t QUEUE_COUNT = std::max<size_t>(workerCount, 1);
+
+    Queues.reserve(QUEUE_COUNT);
+    for (size_t index = 0; index < QUEUE_COUNT; ++index)
+    {
+        Queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    Workers.reserve(workerCount);
+    for (size_t index = 0; index < workerCount; ++index)
+    {
+        Workers.emplace_back([this, index] { WorkerLoop(index); });
+    }
+}
+
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lock(SleepMutex);
+        Stopping.store(true, std::memory_order_release);
+    }
+
+    SleepCondition.notify_all();
+
+    for (auto& worker : Workers)
+    {
+        worker.join();
+    }
+}
+
+
+size_t ThreadPool::GetDefaultWorkerCount()
+{
+    const size_t HARDWARE_THREADS = std::thread::hardware_concurrency();
+
+    return HARDWARE_THREADS > 1 ? HARDWARE_THREADS - 1 : 0;
+}
+
+
+size_t ThreadPool::GetWorkerCount() const
+{
+    return Workers.size();
+}
+
+
+void ThreadPool::Submit(Task task)
+{
+    // 工作线程提交的任务放入自己的队列，外部线程轮流放入各个队列
+    const size_t QUEUE_INDEX = CurrentPool == this ? CurrentWorker
+                                                   : NextQueue.fetch_add(1, std::memory_order_relaxed) % Queues.size();
+
+    {
+        std::lock_guard lock(Queues[QUEUE_INDEX]->Mutex);
+        Queues[QUEUE_INDEX]->Tasks.push_back(std::move(task));
+    }
+
+    QueuedTasks.fetch_add(1, std::memory_order_release);
+
+    // 先获取一次SleepMutex，避免工作线程在检查条件与进入休眠之间错过通知
+    {
+        std::lock_guard lock(SleepMutex);
+    }
+
+    SleepCondition.notify_one();
+}
+
+
+bool ThreadPool::TryRunOne()
+{
+    Task task;
+
+    const size_t PREFERRED = CurrentPool == this ? CurrentWorker : 0;
+
+    if (!PopTask(PREFERRED, task))
+    {
+        return false;
+    }
+
+    task();
+
+    return true;
+}
+
+
+void ThreadPool::Wait(const TaskCounter& counter)
+{
+    while (!counter.IsDone())
+    {
+        if (!TryRunOne())
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+
+void ThreadPool::WorkerLoop(size_t workerIndex)
+{
+    CurrentPool = this;
+    CurrentWorker = workerIndex;
+
+    Task task;
+
+    while (true)
+    {
+        if (PopTask(workerIndex, task))
+        {
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock lock(SleepMutex);
+
+        SleepCondition.wait(lock,
+                            [this]
+                            {
+                                return Stopping.load(std::memory_order_acquire)
+                                       || QueuedTasks.load(std::memory_order_acquire) > 0;
+                            });
+
+        if (Stopping.load(std::memory_order_acquire))
+        {
+            return;
+        }
+    }
+}
+
+
+bool ThreadPool::PopTask(size_t preferred, Task& outTask)
+{
+    if (QueuedTasks.load(std::memory_order_acquire) == 0)
+    {
+        return false;
+    }
+
+    // 从自己队列的尾部取
+    {
+        auto& queue = *Queues[preferred];
+
+        std::lock_guard lock(queue.Mutex);
+        if (!queue.Tasks.empty())
+        {
+            outTask = std::move(queue.Tasks.back());
+            queue.Tasks.pop_back();
+            QueuedTasks.fetch_sub(1, std::memory_order_acq_rel);
+            return true;
+        }
+    }
+
+    // 从其他队列的头部窃取
+    for (size_t offset = 1; offset < Queues.size(); ++offset)
+    {
+        auto& queue = *Queues[(preferred + offset) % Queues.size()];
+
+        std::lock_guard lock(queue.Mutex);
+        if (!queue.Tasks.empty())
+        {
+            outTask = std::move(queue.Tasks.front());
+            queue.Tasks.pop_front();
+            QueuedTasks.fetch_sub(1, std::memory_order_acq_rel);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace NekiraECS